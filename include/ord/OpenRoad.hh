@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -205,8 +206,25 @@ class OpenRoad
 
   void readDb(std::istream& stream);
   void readDb(const char* filename, bool hierarchy = false);
-  void writeDb(std::ostream& stream);
-  void writeDb(const char* filename);
+  void writeDb(std::ostream& stream, bool compress_tables = false);
+  void writeDb(const char* filename, bool compress_tables = false);
+  // Incremental checkpoints against a base database file.  After
+  // beginDbCheckpoint the changes to the block are recorded so that
+  // writeDbIncremental can save only the delta from base_filename.
+  void beginDbCheckpoint(const char* base_filename);
+  void readDbIncremental(const char* filename, const char* base_filename);
+  void writeDbIncremental(const char* filename, const char* base_filename);
+
+  // Size and CRC of a base database file, stored in each checkpoint.
+  struct DbFileId
+  {
+    uint64_t size = 0;
+    uint32_t crc = 0;
+    bool operator!=(const DbFileId& other) const
+    {
+      return size != other.size || crc != other.crc;
+    }
+  };
 
   void setThreadCount(int threads, bool printInfo = true);
   void setThreadCount(const char* threads, bool printInfo = true);
@@ -257,6 +275,8 @@ class OpenRoad
   dft::Dft* dft_ = nullptr;
 
   int threads_ = 1;
+  std::string checkpoint_base_;
+  DbFileId checkpoint_base_id_;
 
   static OpenRoad* app_;
 
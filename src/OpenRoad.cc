@@ -4,11 +4,14 @@
 #include "ord/OpenRoad.hh"
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/crc.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -366,6 +369,7 @@ void OpenRoad::writeDef(const char* filename, const string& version)
       }
       odb::defout def_writer(logger_);
       def_writer.setVersion(stringToDefVersion(version));
+      def_writer.setNumThreads(threads_);
       def_writer.writeBlock(block, filename);
       if (hierarchy_set) {
         sta->getDbNetwork()->setHierarchy();
@@ -489,19 +493,106 @@ void OpenRoad::readDb(std::istream& stream)
   stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
                     | std::ios::eofbit);
 
-  db_->read(stream);
+  db_->read(stream, threads_);
 }
 
-void OpenRoad::writeDb(std::ostream& stream)
+void OpenRoad::writeDb(std::ostream& stream, bool compress_tables)
 {
   stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  db_->write(stream);
+  db_->write(stream, threads_, compress_tables);
 }
 
-void OpenRoad::writeDb(const char* filename)
+void OpenRoad::writeDb(const char* filename, bool compress_tables)
 {
   utl::StreamHandler stream_handler(filename, true);
-  writeDb(stream_handler.getStream());
+  writeDb(stream_handler.getStream(), compress_tables);
+}
+
+// Identifies the exact contents of a base database file so that a
+// checkpoint is only ever replayed onto the file it was recorded against.
+static OpenRoad::DbFileId dbFileId(const char* filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  file.exceptions(std::ifstream::badbit);
+  boost::crc_32_type crc;
+  std::vector<char> buffer(1 << 20);
+  uint64_t size = 0;
+  while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+    crc.process_bytes(buffer.data(), file.gcount());
+    size += file.gcount();
+  }
+  return {size, crc.checksum()};
+}
+
+void OpenRoad::beginDbCheckpoint(const char* base_filename)
+{
+  odb::dbChip* chip = db_->getChip();
+  odb::dbBlock* block = chip ? chip->getBlock() : nullptr;
+  if (!block) {
+    logger_->error(ORD, 69, "No block to record a checkpoint for.");
+  }
+  odb::dbDatabase::beginCheckpoint(block);
+  checkpoint_base_ = base_filename;
+  checkpoint_base_id_ = dbFileId(base_filename);
+}
+
+void OpenRoad::readDbIncremental(const char* filename,
+                                 const char* base_filename)
+{
+  odb::dbChip* chip = db_->getChip();
+  odb::dbBlock* block = chip ? chip->getBlock() : nullptr;
+  if (!block) {
+    logger_->error(ORD, 70, "No block to apply checkpoint {} to.", filename);
+  }
+
+  std::ifstream stream;
+  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                    | std::ios::eofbit);
+  try {
+    stream.open(filename, std::ios::binary);
+
+    DbFileId base_id;
+    stream.read(reinterpret_cast<char*>(&base_id.size), sizeof(base_id.size));
+    stream.read(reinterpret_cast<char*>(&base_id.crc), sizeof(base_id.crc));
+    if (base_id != dbFileId(base_filename)) {
+      logger_->error(ORD,
+                     71,
+                     "Checkpoint {} was not written against {}.",
+                     filename,
+                     base_filename);
+    }
+
+    odb::dbDatabase::readCheckpoint(block, stream);
+  } catch (const std::ios_base::failure& f) {
+    logger_->error(
+        ORD, 72, "checkpoint file {} is invalid: {}", filename, f.what());
+  }
+}
+
+void OpenRoad::writeDbIncremental(const char* filename,
+                                  const char* base_filename)
+{
+  odb::dbChip* chip = db_->getChip();
+  odb::dbBlock* block = chip ? chip->getBlock() : nullptr;
+  std::error_code ec;
+  if (!block || !odb::dbDatabase::hasCheckpoint(block)
+      || checkpoint_base_.empty()
+      || !std::filesystem::equivalent(base_filename, checkpoint_base_, ec)) {
+    logger_->error(ORD,
+                   73,
+                   "No changes are being recorded against {}. Use read_db "
+                   "-checkpoint or write_db -checkpoint to start recording.",
+                   base_filename);
+  }
+
+  utl::StreamHandler stream_handler(filename, true);
+  std::ostream& stream = stream_handler.getStream();
+  stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  stream.write(reinterpret_cast<const char*>(&checkpoint_base_id_.size),
+               sizeof(checkpoint_base_id_.size));
+  stream.write(reinterpret_cast<const char*>(&checkpoint_base_id_.crc),
+               sizeof(checkpoint_base_id_.crc));
+  odb::dbDatabase::writeCheckpoint(block, stream);
 }
 
 void OpenRoad::readVerilog(const char* filename)
@@ -361,10 +361,31 @@ read_db_cmd(const char *filename, bool hierarchy)
 }
 
 void
-write_db_cmd(const char *filename)
+write_db_cmd(const char *filename, bool compress_tables)
 {
   OpenRoad *ord = getOpenRoad();
-  ord->writeDb(filename);
+  ord->writeDb(filename, compress_tables);
+}
+
+void
+begin_db_checkpoint_cmd(const char *base_filename)
+{
+  OpenRoad *ord = getOpenRoad();
+  ord->beginDbCheckpoint(base_filename);
+}
+
+void
+read_db_incremental_cmd(const char *filename, const char *base_filename)
+{
+  OpenRoad *ord = getOpenRoad();
+  ord->readDbIncremental(filename, base_filename);
+}
+
+void
+write_db_incremental_cmd(const char *filename, const char *base_filename)
+{
+  OpenRoad *ord = getOpenRoad();
+  ord->writeDbIncremental(filename, base_filename);
 }
 
 void
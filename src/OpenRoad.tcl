@@ -150,10 +150,12 @@ proc write_cdl { args } {
   ord::write_cdl_cmd $out_filename $masters_filenames $fillers
 }
 
-sta::define_cmd_args "read_db" {[-hier] filename}
+sta::define_cmd_args "read_db" {[-hier] [-incremental checkpoint] \
+                                  [-checkpoint] filename}
 
 proc read_db { args } {
-  sta::parse_key_args "read_db" args keys {} flags {-hier}
+  sta::parse_key_args "read_db" args keys {-incremental} \
+    flags {-hier -checkpoint}
   sta::check_argc_eq1or2 "read_db" $args
   set filename [file nativename [lindex $args 0]]
   if { ![file exists $filename] } {
@@ -164,14 +166,38 @@ proc read_db { args } {
     utl::error "ORD" 8 "$filename is not readable."
   }
   ord::read_db_cmd $filename $hierarchy
+  if { [info exists flags(-checkpoint)] } {
+    ord::begin_db_checkpoint_cmd $filename
+  }
+  if { [info exists keys(-incremental)] } {
+    set checkpoint [file nativename $keys(-incremental)]
+    if { ![file readable $checkpoint] } {
+      utl::error "ORD" 11 "$checkpoint is not readable."
+    }
+    ord::read_db_incremental_cmd $checkpoint $filename
+  }
 }
 
-sta::define_cmd_args "write_db" {filename}
+sta::define_cmd_args "write_db" {[-incremental base_db] [-checkpoint] \
+                                   [-compress_tables] filename}
 
 proc write_db { args } {
+  sta::parse_key_args "write_db" args keys {-incremental} \
+    flags {-checkpoint -compress_tables}
   sta::check_argc_eq1 "write_db" $args
   set filename [file nativename [lindex $args 0]]
-  ord::write_db_cmd $filename
+  if { [info exists keys(-incremental)] } {
+    if { [info exists flags(-checkpoint)] } {
+      utl::error "ORD" 12 "-checkpoint requires a full write_db."
+    }
+    set base_db [file nativename $keys(-incremental)]
+    ord::write_db_incremental_cmd $filename $base_db
+  } else {
+    ord::write_db_cmd $filename [info exists flags(-compress_tables)]
+    if { [info exists flags(-checkpoint)] } {
+      ord::begin_db_checkpoint_cmd $filename
+    }
+  }
 }
 
 sta::define_cmd_args "assign_ndr" { -ndr name (-net name | -all_clocks) }
@@ -75,6 +75,9 @@ struct ParamStruct
   int minAccessPoints = -1;
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
+  bool radixWavefront = false;
+  bool colorTAPanels = false;
+  std::string paCacheFile;
   int num_threads;
 };
 
@@ -149,6 +152,7 @@ class TritonRoute
   std::string runDRWorker(const std::string& workerStr, FlexDRViaData* viaData);
   void debugSingleWorker(const std::string& dumpDir, const std::string& drcRpt);
   void updateGlobals(const char* file_name);
+  void setRadixWavefront(bool on = true);
   void resetDb(const char* file_name);
   void clearDesign();
   void updateDesign(const std::vector<std::string>& updates, int num_threads);
@@ -283,6 +283,11 @@ void TritonRoute::updateGlobals(const char* file_name)
   file.close();
 }
 
+void TritonRoute::setRadixWavefront(bool on)
+{
+  router_cfg_->RADIX_WAVEFRONT = on;
+}
+
 void TritonRoute::resetDb(const char* file_name)
 {
   std::ifstream stream;
@@ -1261,6 +1266,9 @@ void TritonRoute::setParams(const ParamStruct& params)
     router_cfg_->MINNUMACCESSPOINT_MACROCELLPIN = params.minAccessPoints;
   }
   router_cfg_->SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
+  router_cfg_->RADIX_WAVEFRONT = params.radixWavefront;
+  router_cfg_->TA_COLOR_PANELS = params.colorTAPanels;
+  router_cfg_->PA_CACHE_FILE = params.paCacheFile;
   router_cfg_->REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
   router_cfg_->MAX_THREADS = params.num_threads;
 }
@@ -69,7 +69,10 @@ void detailed_route_cmd(const char* outputMazeFile,
                         int minAccessPoints,
                         bool saveGuideUpdates,
                         const char* repairPDNLayerName,
-                        int drcReportIterStep)
+                        int drcReportIterStep,
+                        bool radixWavefront,
+                        bool colorTAPanels,
+                        const char* paCacheFile)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
@@ -98,6 +101,9 @@ void detailed_route_cmd(const char* outputMazeFile,
                     minAccessPoints,
                     saveGuideUpdates,
                     repairPDNLayerName,
+                    radixWavefront,
+                    colorTAPanels,
+                    paCacheFile,
                     num_threads});
   router->main();
   router->setDistributed(false);
@@ -107,7 +113,8 @@ void pin_access_cmd(const char* dbProcessNode,
                     const char* bottomRoutingLayer,
                     const char* topRoutingLayer,
                     int verbose,
-                    int minAccessPoints)
+                    int minAccessPoints,
+                    const char* paCacheFile)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   drt::ParamStruct params;
@@ -116,6 +123,7 @@ void pin_access_cmd(const char* dbProcessNode,
   params.topRoutingLayer = topRoutingLayer;
   params.verbose = verbose;
   params.minAccessPoints = minAccessPoints;
+  params.paCacheFile = paCacheFile;
   params.num_threads = ord::OpenRoad::openRoad()->getThreadCount();
   router->setParams(params);
   router->pinAccess();
@@ -177,7 +185,10 @@ set_worker_debug_params(int maze_end_iter,
 }
 
 void
-run_worker_cmd(const char* dump_dir, const char* worker_dir, const char* drc_rpt)
+run_worker_cmd(const char* dump_dir,
+               const char* worker_dir,
+               const char* drc_rpt,
+               bool radix_wavefront)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   router->updateGlobals(fmt::format("{}/init_router_cfg.bin", dump_dir).c_str());
@@ -185,6 +196,9 @@ run_worker_cmd(const char* dump_dir, const char* worker_dir, const char* drc_rpt
   const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
   router->updateDesign(fmt::format("{}/{}/updates.bin", dump_dir, worker_dir).c_str(), num_threads);
   router->updateGlobals(fmt::format("{}/{}/worker_router_cfg.bin", dump_dir, worker_dir).c_str());
+  if (radix_wavefront) {
+    router->setRadixWavefront(true);
+  }
   
   router->debugSingleWorker(fmt::format("{}/{}", dump_dir, worker_dir), drc_rpt);
 }
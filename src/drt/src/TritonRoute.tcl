@@ -28,6 +28,9 @@ sta::define_cmd_args "detailed_route" {
     [-save_guide_updates]
     [-repair_pdn_vias layer]
     [-single_step_dr]
+    [-radix_wavefront]
+    [-color_ta_panels]
+    [-pin_access_cache file]
 }
 
 proc detailed_route { args } {
@@ -36,9 +39,11 @@ proc detailed_route { args } {
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step} \
+      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step \
+      -pin_access_cache} \
     flags {-disable_via_gen -distributed -clean_patches -no_pin_access \
-           -single_step_dr -save_guide_updates}
+           -single_step_dr -save_guide_updates -radix_wavefront \
+           -color_ta_panels}
   sta::check_argc_eq0 "detailed_route" $args
 
   set enable_via_gen [expr ![info exists flags(-disable_via_gen)]]
@@ -48,6 +53,8 @@ proc detailed_route { args } {
   # development.  It is not listed in the help string intentionally.
   set single_step_dr [expr [info exists flags(-single_step_dr)]]
   set save_guide_updates [expr [info exists flags(-save_guide_updates)]]
+  set radix_wavefront [expr [info exists flags(-radix_wavefront)]]
+  set color_ta_panels [expr [info exists flags(-color_ta_panels)]]
 
   if { [info exists keys(-repair_pdn_vias)] } {
     set repair_pdn_vias $keys(-repair_pdn_vias)
@@ -160,12 +167,18 @@ proc detailed_route { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
   drt::detailed_route_cmd $output_maze $output_drc $output_cmap \
     $output_guide_coverage $db_process_node $enable_via_gen $droute_end_iter \
     $via_in_pin_bottom_layer $via_in_pin_top_layer \
     $or_seed $or_k $bottom_routing_layer $top_routing_layer $verbose \
     $clean_patches $no_pin_access $single_step_dr $min_access_points \
-    $save_guide_updates $repair_pdn_vias $drc_report_iter_step
+    $save_guide_updates $repair_pdn_vias $drc_report_iter_step \
+    $radix_wavefront $color_ta_panels $pin_access_cache
 }
 
 proc detailed_route_num_drvs { args } {
@@ -266,11 +279,13 @@ sta::define_cmd_args "pin_access" {
     [-remote_port rport]
     [-shared_volume vol]
     [-cloud_size sz]
+    [-pin_access_cache file]
 }
 proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
     keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
-          -min_access_points -remote_host -remote_port -shared_volume -cloud_size } \
+          -min_access_points -remote_host -remote_port -shared_volume -cloud_size \
+          -pin_access_cache } \
     flags {-distributed}
   sta::check_argc_eq0 "detailed_route_debug" $args
   if { [info exists keys(-db_process_node)] } {
@@ -323,20 +338,26 @@ proc pin_access { args } {
     }
     drt::detailed_route_distributed $rhost $rport $vol $cloudsz
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
   drt::pin_access_cmd $db_process_node $bottom_routing_layer \
-    $top_routing_layer $verbose $min_access_points
+    $top_routing_layer $verbose $min_access_points $pin_access_cache
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
     [-dump_dir dir]
     [-worker_dir dir]
     [-drc_rpt drc]
+    [-radix_wavefront]
 } ;# checker off
 
 proc detailed_route_run_worker { args } {
   sta::parse_key_args "detailed_route_run_worker" args \
     keys {-dump_dir -worker_dir -drc_rpt} \
-    flags {} ;# checker off
+    flags {-radix_wavefront} ;# checker off
   sta::check_argc_eq0 "detailed_route_run_worker" $args
   if { [info exists keys(-dump_dir)] } {
     set dump_dir $keys(-dump_dir)
@@ -355,7 +376,8 @@ proc detailed_route_run_worker { args } {
   } else {
     set drc_rpt ""
   }
-  drt::run_worker_cmd $dump_dir $worker_dir $drc_rpt
+  set radix_wavefront [info exists flags(-radix_wavefront)]
+  drt::run_worker_cmd $dump_dir $worker_dir $drc_rpt $radix_wavefront
 }
 
 sta::define_cmd_args "detailed_route_worker_debug" {
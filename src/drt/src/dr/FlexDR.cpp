@@ -124,6 +124,14 @@ std::string FlexDRWorker::reloadedMain()
   if (!skipRouting_) {
     route_queue();
   }
+  debugPrint(
+      logger_,
+      utl::DRT,
+      "maze_search",
+      1,
+      "Maze search time {:.3f} ms in {} searches",
+      std::chrono::duration<double, std::milli>(mazeSearchTime_).count(),
+      numMazeSearches_);
   setGCWorker(nullptr);
   cleanup();
   std::string workerStr;
@@ -285,6 +293,14 @@ int FlexDRWorker::main(frDesign* design)
              duration_cast<duration<double>>(t3 - t0).count(),
              getInitNumMarkers(),
              num_markers);
+  debugPrint(
+      logger_,
+      DRT,
+      "maze_search",
+      1,
+      "Maze search time {:.3f} ms in {} searches",
+      std::chrono::duration<double, std::milli>(mazeSearchTime_).count(),
+      numMazeSearches_);
 
   return 0;
 }
@@ -708,6 +724,87 @@ void FlexDR::processWorkersBatch(
   exception.rethrow();
 }
 
+void FlexDR::processWorkersLevels(
+    std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+    const int num_x,
+    const int num_y,
+    const int batch_step_x,
+    const int batch_step_y,
+    IterationProgress& iter_prog)
+{
+  // The checkerboard colors of the workers; a worker only overlaps the
+  // workers around it, which all have other colors.
+  auto color = [=](const int idx) {
+    return (idx / num_y % batch_step_x) * batch_step_y
+           + idx % num_y % batch_step_y;
+  };
+  std::vector<int> order(workers.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return color(a) < color(b);
+  });
+
+  // A worker past the first iterations skips routing unless it starts with
+  // markers, and only an earlier neighbor that routes can bring it some.
+  // Such a neighbor must be committed before the worker runs, which puts
+  // it at a later level. Workers that cannot route wait for nothing.
+  const auto region_query = getDesign()->getRegionQuery();
+  std::vector<bool> active(workers.size(), iter_ <= 1);
+  std::vector<int> level(workers.size(), 0);
+  int num_levels = 1;
+  std::vector<frMarker*> markers;
+  for (const int idx : order) {
+    if (!active[idx]) {
+      markers.clear();
+      region_query->queryMarker(workers[idx]->getDrcBox(), markers);
+      active[idx] = !markers.empty();
+    }
+    const int x = idx / num_y;
+    const int y = idx % num_y;
+    for (int nbr_x = std::max(x - 1, 0); nbr_x <= std::min(x + 1, num_x - 1);
+         nbr_x++) {
+      for (int nbr_y = std::max(y - 1, 0);
+           nbr_y <= std::min(y + 1, num_y - 1);
+           nbr_y++) {
+        const int nbr = nbr_x * num_y + nbr_y;
+        if (nbr == idx || color(nbr) >= color(idx) || !active[nbr]) {
+          continue;
+        }
+        active[idx] = true;
+        level[idx] = std::max(level[idx], level[nbr] + 1);
+      }
+    }
+    num_levels = std::max(num_levels, level[idx] + 1);
+  }
+
+  // Workers of a level never read what another one of the level commits,
+  // they are committed in checkerboard order like the batches of a color.
+  std::vector<std::vector<int>> levels(num_levels);
+  for (const int idx : order) {
+    levels[level[idx]].push_back(idx);
+  }
+  for (const std::vector<int>& level_workers : levels) {
+    ProfileTask profile("DR:level");
+    for (size_t begin = 0; begin < level_workers.size();
+         begin += router_cfg_->BATCHSIZE) {
+      const size_t end = std::min(level_workers.size(),
+                                  begin + router_cfg_->BATCHSIZE);
+      std::vector<std::unique_ptr<FlexDRWorker>> batch;
+      batch.reserve(end - begin);
+      for (size_t i = begin; i < end; i++) {
+        batch.push_back(std::move(workers[level_workers[i]]));
+      }
+      {
+        const std::string batch_name
+            = std::string("DR:batch<") + std::to_string(batch.size()) + ">";
+        ProfileTask profile(batch_name.c_str());
+        processWorkersBatch(batch, iter_prog);
+      }
+      endWorkersBatch(batch);
+    }
+  }
+}
+
 void FlexDR::processWorkersBatchDistributed(
     std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
     int& version,
@@ -1174,55 +1271,61 @@ void FlexDR::optimizationFlow(const SearchRepairArgs& args,
       = (((int) xgp.getCount() - 1 - offset) / size + 1)
         * (((int) ygp.getCount() - 1 - offset) / size + 1);
 
-  std::vector<std::unique_ptr<FlexDRWorker>> uworkers;
   int batchStepX, batchStepY;
 
   getBatchInfo(batchStepX, batchStepY);
 
-  std::vector<std::vector<std::vector<std::unique_ptr<FlexDRWorker>>>> workers(
-      batchStepX * batchStepY);
-
-  int xIdx = 0, yIdx = 0;
-  for (int i = offset; i < (int) xgp.getCount(); i += size) {
-    for (int j = offset; j < (int) ygp.getCount(); j += size) {
-      auto worker = createWorker(i, j, args);
-      int batch_idx = (xIdx % batchStepX) * batchStepY + yIdx % batchStepY;
-      const bool create_new_batch
-          = workers[batch_idx].empty()
-            || (!dist_on_
-                && workers[batch_idx].back().size() >= router_cfg_->BATCHSIZE);
-      if (create_new_batch) {
-        workers[batch_idx].push_back(
-            std::vector<std::unique_ptr<FlexDRWorker>>());
-      }
-      workers[batch_idx].back().push_back(std::move(worker));
-
-      yIdx++;
-    }
-    yIdx = 0;
-    xIdx++;
-  }
-
   omp_set_num_threads(router_cfg_->MAX_THREADS);
-  int version = 0;
   increaseClipsize_ = false;
   numWorkUnits_ = 0;
-  // parallel execution
-  for (auto& workerBatch : workers) {
-    ProfileTask profile("DR:checkerboard");
-    for (auto& workersInBatch : workerBatch) {
-      {
-        const std::string batch_name = std::string("DR:batch<")
-                                       + std::to_string(workersInBatch.size())
-                                       + ">";
-        ProfileTask profile(batch_name.c_str());
-        if (dist_on_) {
+
+  if (!dist_on_) {
+    const int num_x = ((int) xgp.getCount() - 1 - offset) / size + 1;
+    const int num_y = ((int) ygp.getCount() - 1 - offset) / size + 1;
+    std::vector<std::unique_ptr<FlexDRWorker>> workers;
+    workers.reserve(num_x * num_y);
+    for (int i = offset; i < (int) xgp.getCount(); i += size) {
+      for (int j = offset; j < (int) ygp.getCount(); j += size) {
+        workers.push_back(createWorker(i, j, args));
+      }
+    }
+    processWorkersLevels(
+        workers, num_x, num_y, batchStepX, batchStepY, iter_prog);
+  } else {
+    std::vector<std::vector<std::vector<std::unique_ptr<FlexDRWorker>>>>
+        workers(batchStepX * batchStepY);
+
+    int xIdx = 0, yIdx = 0;
+    for (int i = offset; i < (int) xgp.getCount(); i += size) {
+      for (int j = offset; j < (int) ygp.getCount(); j += size) {
+        auto worker = createWorker(i, j, args);
+        int batch_idx = (xIdx % batchStepX) * batchStepY + yIdx % batchStepY;
+        if (workers[batch_idx].empty()) {
+          workers[batch_idx].push_back(
+              std::vector<std::unique_ptr<FlexDRWorker>>());
+        }
+        workers[batch_idx].back().push_back(std::move(worker));
+
+        yIdx++;
+      }
+      yIdx = 0;
+      xIdx++;
+    }
+
+    int version = 0;
+    // parallel execution
+    for (auto& workerBatch : workers) {
+      ProfileTask profile("DR:checkerboard");
+      for (auto& workersInBatch : workerBatch) {
+        {
+          const std::string batch_name
+              = std::string("DR:batch<") + std::to_string(workersInBatch.size())
+                + ">";
+          ProfileTask profile(batch_name.c_str());
           processWorkersBatchDistributed(workersInBatch, version, iter_prog);
-        } else {
-          processWorkersBatch(workersInBatch, iter_prog);
         }
+        endWorkersBatch(workersInBatch);
       }
-      endWorkersBatch(workersInBatch);
     }
   }
 
@@ -1872,6 +1975,7 @@ int FlexDR::main()
 
   end(/* done */ true);
   reporter->end(true);
+  FlexGridGraph::releaseCostPool();
 
   if (!router_cfg_->GUIDE_REPORT_FILE.empty()) {
     reportGuideCoverage();
@@ -7,6 +7,7 @@
 
 #include <boost/polygon/polygon.hpp>
 #include <boost/serialization/export.hpp>
+#include <chrono>
 #include <deque>
 #include <map>
 #include <memory>
@@ -182,6 +183,16 @@ class FlexDR
       std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
       IterationProgress& iter_prog);
 
+  // Runs the workers of a checkerboard iteration in levels: a worker waits
+  // for the overlapping workers of earlier colors that may change its area
+  // rather than for whole colors.
+  void processWorkersLevels(
+      std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+      int num_x,
+      int num_y,
+      int batch_step_x,
+      int batch_step_y,
+      IterationProgress& iter_prog);
   void processWorkersBatchDistributed(
       std::vector<std::unique_ptr<FlexDRWorker>>& workers_batch,
       int& version,
@@ -505,6 +516,10 @@ class FlexDRWorker
   frOrderedIdMap<frNet*, std::set<std::pair<Point, frLayerNum>>> boundaryPin_;
   int pinCnt_{0};
   int initNumMarkers_{0};
+  // time spent in FlexGridGraph::search, reported under the DRT
+  // maze_search debug group; not serialized
+  std::chrono::steady_clock::duration mazeSearchTime_{0};
+  int numMazeSearches_{0};
   std::map<FlexMazeIdx, drAccessPattern*> apSVia_;
   std::set<FlexMazeIdx> planarHistoryMarkers_;
   std::set<FlexMazeIdx> viaHistoryMarkers_;
@@ -3231,14 +3231,18 @@ bool FlexDRWorker::routeNet(drNet* net, std::vector<FlexMazeIdx>& paths)
     auto nextPin = routeNet_getNextDst(
         ccMazeIdx1, ccMazeIdx2, mazeIdx2unConnPins, pinTaperBoxes);
     path.clear();
-    if (gridGraph_.search(connComps,
-                          nextPin,
-                          path,
-                          ccMazeIdx1,
-                          ccMazeIdx2,
-                          centerPt,
-                          mazeIdx2TaperBox,
-                          route_with_jumpers)) {
+    const auto search_start = std::chrono::steady_clock::now();
+    const bool found = gridGraph_.search(connComps,
+                                         nextPin,
+                                         path,
+                                         ccMazeIdx1,
+                                         ccMazeIdx2,
+                                         centerPt,
+                                         mazeIdx2TaperBox,
+                                         route_with_jumpers);
+    mazeSearchTime_ += std::chrono::steady_clock::now() - search_start;
+    numMazeSearches_++;
+    if (found) {
       routeNet_postAstarUpdate(
           path, connComps, unConnPins, mazeIdx2unConnPins, isFirstConn);
       routeNet_postAstarWritePath(
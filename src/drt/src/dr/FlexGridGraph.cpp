@@ -6,6 +6,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "dr/FlexDR.h"
@@ -41,6 +42,47 @@ void initCoords(const frLayerCoordTrackPatternMap& map,
   }
 }
 
+struct FlexGridGraph::CostPool
+{
+  std::mutex mutex;
+  std::vector<frVector<NodeCosts>> storage;
+};
+
+FlexGridGraph::CostPool& FlexGridGraph::getCostPool()
+{
+  static CostPool pool;
+  return pool;
+}
+
+void FlexGridGraph::takeCostStorage(frVector<NodeCosts>& costs)
+{
+  CostPool& pool = getCostPool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  if (!pool.storage.empty()) {
+    costs.swap(pool.storage.back());
+    pool.storage.pop_back();
+  }
+  costs.clear();
+}
+
+void FlexGridGraph::returnCostStorage(frVector<NodeCosts>& costs)
+{
+  costs.clear();
+  if (costs.capacity() > 0) {
+    CostPool& pool = getCostPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.storage.emplace_back().swap(costs);
+  }
+}
+
+void FlexGridGraph::releaseCostPool()
+{
+  CostPool& pool = getCostPool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  pool.storage.clear();
+  pool.storage.shrink_to_fit();
+}
+
 bool FlexGridGraph::isAccessPointLocation(frLayerNum layer_num,
                                           frCoord x_coord,
                                           frCoord y_coord) const
@@ -79,6 +121,9 @@ void FlexGridGraph::initGrids(const frLayerCoordTrackPatternMap& xMap,
 
   nodes_.clear();
   nodes_.resize(capacity, Node());
+  costTiles_.assign(capacity / cost_tile_size + 1, 0);
+  returnCostStorage(nodeCosts_);
+  takeCostStorage(nodeCosts_);
   // new
   prevDirs_.clear();
   srcs_.clear();
@@ -35,6 +35,10 @@ class AbstractDRGraphics;
 class FlexGridGraph
 {
  public:
+  // Frees the cost tile storage kept for reuse between workers once
+  // detailed routing is done.
+  static void releaseCostPool();
+
   // constructors
   FlexGridGraph(frTechObject* techIn,
                 Logger* loggerIn,
@@ -254,7 +258,7 @@ class FlexGridGraph
     frUInt4 sol = 0;
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
+      const NodeCosts& node = getNodeCosts(getIdx(x, y, z));
       if (dir == frDirEnum::W || dir == frDirEnum::E) {
         if (consider_ndr) {
           sol = std::max(node.fixedShapeCostPlanarHorz,
@@ -272,7 +276,7 @@ class FlexGridGraph
       }
     } else {
       correctU(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
+      const NodeCosts& node = getNodeCosts(getIdx(x, y, z));
       if (isOverrideShapeCost(x, y, z, dir)) {
         sol = 0;
       } else {
@@ -314,19 +318,19 @@ class FlexGridGraph
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
       if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostPlanar,
-                       nodes_[idx].routeShapeCostPlanarNDR);
+        sol = std::max(getNodeCosts(idx).routeShapeCostPlanar,
+                       getNodeCosts(idx).routeShapeCostPlanarNDR);
       } else {
-        sol = nodes_[idx].routeShapeCostPlanar;
+        sol = getNodeCosts(idx).routeShapeCostPlanar;
       }
     } else {
       correctU(x, y, z, dir);
       auto idx = getIdx(x, y, z);
       if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostVia,
-                       nodes_[idx].routeShapeCostViaNDR);
+        sol = std::max(getNodeCosts(idx).routeShapeCostVia,
+                       getNodeCosts(idx).routeShapeCostViaNDR);
       } else {
-        sol = nodes_[idx].routeShapeCostVia;
+        sol = getNodeCosts(idx).routeShapeCostVia;
       }
     }
     return (sol);
@@ -347,11 +351,11 @@ class FlexGridGraph
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostPlanar;
+      sol += getNodeCosts(idx).markerCostPlanar;
     } else {
       correctU(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostVia;
+      sol += getNodeCosts(idx).markerCostVia;
     }
     return (sol);
   }
@@ -506,7 +510,7 @@ class FlexGridGraph
   }
   void addRouteShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.routeShapeCostPlanarNDR = addToByte(node.routeShapeCostPlanarNDR, 1);
     } else {
@@ -515,7 +519,7 @@ class FlexGridGraph
   }
   void addRouteShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.routeShapeCostViaNDR = addToByte(node.routeShapeCostViaNDR, 1);
     } else {
@@ -524,7 +528,7 @@ class FlexGridGraph
   }
   void subRouteShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.routeShapeCostPlanarNDR
           = subFromByte(node.routeShapeCostPlanarNDR, 1);
@@ -534,7 +538,7 @@ class FlexGridGraph
   }
   void subRouteShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.routeShapeCostViaNDR = subFromByte(node.routeShapeCostViaNDR, 1);
     } else {
@@ -543,7 +547,7 @@ class FlexGridGraph
   }
   void resetRouteShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.routeShapeCostViaNDR = 0;
     } else {
@@ -552,19 +556,19 @@ class FlexGridGraph
   }
   void addMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
+    auto& node = getNodeCostsForUpdate(getIdx(x, y, z));
     node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
   }
   void addMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
+    auto& node = getNodeCostsForUpdate(getIdx(x, y, z));
     node.markerCostVia = addToByte(node.markerCostVia, 10);
   }
   void addMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
     correct(x, y, z, dir);
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      NodeCosts& node = getNodeCostsForUpdate(getIdx(x, y, z));
       switch (dir) {
         case frDirEnum::E:
         case frDirEnum::N:
@@ -580,7 +584,7 @@ class FlexGridGraph
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z, float d)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
+    NodeCosts& node = getNodeCostsForUpdate(idx);
     int currCost = node.markerCostPlanar;
     currCost *= d;
     currCost = std::max(0, currCost);
@@ -590,7 +594,7 @@ class FlexGridGraph
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z, float d)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
+    NodeCosts& node = getNodeCostsForUpdate(idx);
     int currCost = node.markerCostVia;
     currCost *= d;
     currCost = std::max(0, currCost);
@@ -600,7 +604,7 @@ class FlexGridGraph
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
+    NodeCosts& node = getNodeCostsForUpdate(idx);
     int currCost = node.markerCostPlanar;
     currCost--;
     currCost = std::max(0, currCost);
@@ -610,7 +614,7 @@ class FlexGridGraph
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
     auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
+    NodeCosts& node = getNodeCostsForUpdate(idx);
     int currCost = node.markerCostVia;
     currCost--;
     currCost = std::max(0, currCost);
@@ -622,7 +626,7 @@ class FlexGridGraph
     correct(x, y, z, dir);
     int currCost = 0;
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      NodeCosts& node = getNodeCostsForUpdate(getIdx(x, y, z));
       switch (dir) {
         case frDirEnum::E:
           currCost = node.markerCostPlanar;
@@ -646,7 +650,7 @@ class FlexGridGraph
   }
   void addFixedShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostPlanarHorzNDR
           = addToByte(node.fixedShapeCostPlanarHorzNDR, 1);
@@ -661,7 +665,7 @@ class FlexGridGraph
   }
   void setFixedShapeCostPlanarVert(frMIdx idx, frUInt4 c, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostPlanarVertNDR = c;
     } else {
@@ -670,7 +674,7 @@ class FlexGridGraph
   }
   void setFixedShapeCostPlanarHorz(frMIdx idx, frUInt4 c, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostPlanarHorzNDR = c;
     } else {
@@ -679,7 +683,7 @@ class FlexGridGraph
   }
   void addFixedShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostViaNDR = addToByte(node.fixedShapeCostViaNDR, 1);
     } else {
@@ -688,7 +692,7 @@ class FlexGridGraph
   }
   void setFixedShapeCostVia(frMIdx idx, frUInt4 c, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostViaNDR = c;
     } else {
@@ -697,7 +701,7 @@ class FlexGridGraph
   }
   void subFixedShapeCostPlanar(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostPlanarHorzNDR
           = subFromByte(node.fixedShapeCostPlanarHorzNDR, 1);
@@ -712,7 +716,7 @@ class FlexGridGraph
   }
   void subFixedShapeCostVia(frMIdx idx, bool ndr = false)
   {
-    auto& node = nodes_[idx];
+    auto& node = getNodeCostsForUpdate(idx);
     if (ndr) {
       node.fixedShapeCostViaNDR = subFromByte(node.fixedShapeCostViaNDR, 1);
     } else {
@@ -928,6 +932,9 @@ class FlexGridGraph
   {
     nodes_.clear();
     nodes_.shrink_to_fit();
+    costTiles_.clear();
+    costTiles_.shrink_to_fit();
+    returnCostStorage(nodeCosts_);
     srcs_.clear();
     srcs_.shrink_to_fit();
     dsts_.clear();
@@ -951,6 +958,7 @@ class FlexGridGraph
   void printNode(frMIdx x, frMIdx y, frMIdx z)
   {
     Node& n = nodes_[getIdx(x, y, z)];
+    const NodeCosts& c = getNodeCosts(getIdx(x, y, z));
     std::cout << "\nNode ( " << x << " " << y << " " << z << " ) (idx) / "
               << " ( " << xCoords_[x] << " " << yCoords_[y] << " ) (coords)\n";
     std::cout << "hasEastEdge " << n.hasEastEdge << "\n";
@@ -964,14 +972,14 @@ class FlexGridGraph
     std::cout << "hasGridCostEast " << n.hasGridCostEast << "\n";
     std::cout << "hasGridCostNorth " << n.hasGridCostNorth << "\n";
     std::cout << "hasGridCostUp " << n.hasGridCostUp << "\n";
-    std::cout << "routeShapeCostPlanar " << n.routeShapeCostPlanar << "\n";
-    std::cout << "routeShapeCostVia " << n.routeShapeCostVia << "\n";
-    std::cout << "markerCostPlanar " << n.markerCostPlanar << "\n";
-    std::cout << "markerCostVia " << n.markerCostVia << "\n";
-    std::cout << "fixedShapeCostVia " << n.fixedShapeCostVia << "\n";
-    std::cout << "fixedShapeCostPlanarHorz " << n.fixedShapeCostPlanarHorz
+    std::cout << "routeShapeCostPlanar " << c.routeShapeCostPlanar << "\n";
+    std::cout << "routeShapeCostVia " << c.routeShapeCostVia << "\n";
+    std::cout << "markerCostPlanar " << c.markerCostPlanar << "\n";
+    std::cout << "markerCostVia " << c.markerCostVia << "\n";
+    std::cout << "fixedShapeCostVia " << c.fixedShapeCostVia << "\n";
+    std::cout << "fixedShapeCostPlanarHorz " << c.fixedShapeCostPlanarHorz
               << "\n";
-    std::cout << "fixedShapeCostPlanarVert " << n.fixedShapeCostPlanarVert
+    std::cout << "fixedShapeCostPlanarVert " << c.fixedShapeCostPlanarVert
               << "\n";
   }
 
@@ -996,56 +1004,73 @@ class FlexGridGraph
   static constexpr int cost_bits = 8;
 #endif
 
+  // Edges and flags of a node, allocated for every node of the grid.
   struct Node
   {
     Node() { std::memset(this, 0, sizeof(Node)); }
     // Byte 0
-    frUInt4 hasEastEdge : 1;
-    frUInt4 hasNorthEdge : 1;
-    frUInt4 hasUpEdge : 1;
-    frUInt4 isBlockedEast : 1;
-    frUInt4 isBlockedNorth : 1;
-    frUInt4 isBlockedUp : 1;
-    frUInt4 unused1 : 1;
-    frUInt4 unused2 : 1;
+    uint16_t hasEastEdge : 1;
+    uint16_t hasNorthEdge : 1;
+    uint16_t hasUpEdge : 1;
+    uint16_t isBlockedEast : 1;
+    uint16_t isBlockedNorth : 1;
+    uint16_t isBlockedUp : 1;
+    uint16_t unused1 : 1;
+    uint16_t unused2 : 1;
     // Byte 1
-    frUInt4 hasSpecialVia : 1;
-    frUInt4 overrideShapeCostVia : 1;
-    frUInt4 hasGridCostEast : 1;
-    frUInt4 hasGridCostNorth : 1;
-    frUInt4 hasGridCostUp : 1;
-    frUInt4 unused3 : 1;
-    frUInt4 unused4 : 1;
-    frUInt4 unused5 : 1;
-    // Byte 2
+    uint16_t hasSpecialVia : 1;
+    uint16_t overrideShapeCostVia : 1;
+    uint16_t hasGridCostEast : 1;
+    uint16_t hasGridCostNorth : 1;
+    uint16_t hasGridCostUp : 1;
+    uint16_t unused3 : 1;
+    uint16_t unused4 : 1;
+    uint16_t unused5 : 1;
+  };
+  static_assert(sizeof(Node) == 2);
+
+  // Costs of a node, only allocated for the cost tiles that have any.
+  struct NodeCosts
+  {
+    NodeCosts() { std::memset(this, 0, sizeof(NodeCosts)); }
+    // Byte 0
     frUInt4 routeShapeCostPlanar : cost_bits;
-    // Byte 3
+    // Byte 1
     frUInt4 routeShapeCostVia : cost_bits;
-    // Byte4
+    // Byte 2
     frUInt4 markerCostPlanar : cost_bits;
-    // Byte5
+    // Byte 3
     frUInt4 markerCostVia : cost_bits;
-    // Byte6
+    // Byte 4
     frUInt4 fixedShapeCostVia : cost_bits;
-    // Byte7
+    // Byte 5
     frUInt4 fixedShapeCostPlanarHorz : cost_bits;
-    // Byte8
+    // Byte 6
     frUInt4 fixedShapeCostPlanarVert : cost_bits;
-    // Byte9
+    // Byte 7
     frUInt4 routeShapeCostPlanarNDR : cost_bits;
-    // Byte10
+    // Byte 8
     frUInt4 routeShapeCostViaNDR : cost_bits;
-    // Byte 11
+    // Byte 9
     frUInt4 fixedShapeCostViaNDR : cost_bits;
-    // Byte 12
+    // Byte 10
     frUInt4 fixedShapeCostPlanarHorzNDR : cost_bits;
-    // Byte 13
+    // Byte 11
     frUInt4 fixedShapeCostPlanarVertNDR : cost_bits;
   };
 #ifndef DEBUG_DRT_UNDERFLOW
-  static_assert(sizeof(Node) == 16);
+  static_assert(sizeof(NodeCosts) == 12);
 #endif
+  // A cost tile is a run of consecutive nodes along a track.
+  static constexpr int cost_tile_bits = 6;
+  static constexpr frMIdx cost_tile_size = 1 << cost_tile_bits;
+  inline static const NodeCosts zero_costs_;
+
   frVector<Node> nodes_;
+  // per cost tile, 0 if its costs are all zero, else 1 + its index in
+  // nodeCosts_
+  frVector<frUInt4> costTiles_;
+  frVector<NodeCosts> nodeCosts_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
   std::vector<bool> dsts_;
@@ -1126,6 +1151,34 @@ class FlexGridGraph
     return zDirModifier + partialCoordinates;
   }
 
+  const NodeCosts& getNodeCosts(frMIdx idx) const
+  {
+    const frUInt4 tile = costTiles_[idx >> cost_tile_bits];
+    if (tile == 0) {
+      return zero_costs_;
+    }
+    return nodeCosts_[((tile - 1) << cost_tile_bits)
+                      + (idx & (cost_tile_size - 1))];
+  }
+  // Allocates the costs of the node's tile if it has none yet, references
+  // to other nodes' costs may be invalidated.
+  NodeCosts& getNodeCostsForUpdate(frMIdx idx)
+  {
+    frUInt4& tile = costTiles_[idx >> cost_tile_bits];
+    if (tile == 0) {
+      tile = nodeCosts_.size() / cost_tile_size + 1;
+      nodeCosts_.resize(nodeCosts_.size() + cost_tile_size);
+    }
+    return nodeCosts_[((tile - 1) << cost_tile_bits)
+                      + (idx & (cost_tile_size - 1))];
+  }
+  // The cost tiles' storage is handed from finished workers to the next
+  // ones through a shared pool, which releaseCostPool frees.
+  struct CostPool;
+  static CostPool& getCostPool();
+  static void takeCostStorage(frVector<NodeCosts>& costs);
+  static void returnCostStorage(frVector<NodeCosts>& costs);
+
   frUInt4 addToByte(frUInt4 augend, frUInt4 summand)
   {
     frUInt4 result = augend + summand;
@@ -742,6 +742,7 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
   }
 
   wavefront_.cleanup();
+  wavefront_.setRadix(router_cfg_->RADIX_WAVEFRONT);
   // init wavefront
   Point currPt;
   for (auto& idx : connComps) {
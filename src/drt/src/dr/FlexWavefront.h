@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "dr/FlexMazeTypes.h"
 #include "frBaseTypes.h"
@@ -52,6 +54,37 @@ class FlexWavefrontGrid
     }
     return pathCost_ < b.pathCost_;  // prefer larger pathcost, DFS-style
   }
+  // operator< with the remaining ties broken on the position and state of
+  // the grids, for queues whose pop order would otherwise depend on their
+  // push history.
+  bool totalLess(const FlexWavefrontGrid& b) const
+  {
+    if (*this < b) {
+      return true;
+    }
+    if (b < *this) {
+      return false;
+    }
+    if (xIdx_ != b.xIdx_) {
+      return xIdx_ > b.xIdx_;
+    }
+    if (yIdx_ != b.yIdx_) {
+      return yIdx_ > b.yIdx_;
+    }
+    if (backTraceBuffer_ != b.backTraceBuffer_) {
+      return backTraceBuffer_.to_ulong() > b.backTraceBuffer_.to_ulong();
+    }
+    if (prevViaUp_ != b.prevViaUp_) {
+      return prevViaUp_ > b.prevViaUp_;
+    }
+    if (vLengthX_ != b.vLengthX_) {
+      return vLengthX_ > b.vLengthX_;
+    }
+    if (vLengthY_ != b.vLengthY_) {
+      return vLengthY_ > b.vLengthY_;
+    }
+    return tLength_ > b.tLength_;
+  }
   // getters
   frMIdx x() const { return xIdx_; }
   frMIdx y() const { return yIdx_; }
@@ -130,18 +163,172 @@ class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
   }
 };
 
+// Radix heap on the integer cost of the grids. Bucket i > 0 holds the grids
+// whose cost first differs from the last extracted cost at bit i - 1, so a
+// pop only sifts the grids of the lowest cost. Bucket 0 holds the grids of
+// that cost (and the rare ones pushed below it, as the estimate is not
+// always consistent) in a binary heap ordered by FlexWavefrontGrid::totalLess.
+// That is the order of myPriorityQueue, except that grids myPriorityQueue
+// considers equal are popped in a fixed order rather than by push history,
+// so the search may break such ties differently. The grids stay in a pool
+// and the buckets only move their slot numbers.
+class myRadixQueue
+{
+ public:
+  bool empty() const { return size_ == 0; }
+  const FlexWavefrontGrid& top() const { return pool_[buckets_[0].front()]; }
+  void pop()
+  {
+    auto& bucket = buckets_[0];
+    std::pop_heap(bucket.begin(), bucket.end(), Less{this});
+    free_.push_back(bucket.back());
+    bucket.pop_back();
+    size_--;
+    if (bucket.empty() && size_ > 0) {
+      refill();
+    }
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    frUInt4 slot;
+    if (free_.empty()) {
+      slot = pool_.size();
+      pool_.push_back(in);
+    } else {
+      slot = free_.back();
+      free_.pop_back();
+      pool_[slot] = in;
+    }
+    const int idx = getBucketIdx(in.getCost());
+    buckets_[idx].push_back(slot);
+    if (idx == 0) {
+      std::push_heap(buckets_[0].begin(), buckets_[0].end(), Less{this});
+    }
+    size_++;
+    if (buckets_[0].empty()) {
+      refill();
+    }
+  }
+  unsigned int size() const { return size_; }
+  void cleanup()
+  {
+    for (auto& bucket : buckets_) {
+      bucket.clear();
+    }
+    pool_.clear();
+    free_.clear();
+    last_ = 0;
+    size_ = 0;
+  }
+  void fit()
+  {
+    cleanup();
+    for (auto& bucket : buckets_) {
+      bucket.shrink_to_fit();
+    }
+    pool_.shrink_to_fit();
+    free_.shrink_to_fit();
+  }
+
+ private:
+  static constexpr int num_buckets = sizeof(frCost) * 8 + 1;
+
+  struct Less
+  {
+    const myRadixQueue* queue;
+    bool operator()(frUInt4 a, frUInt4 b) const
+    {
+      return queue->pool_[a].totalLess(queue->pool_[b]);
+    }
+  };
+
+  int getBucketIdx(frCost cost) const
+  {
+    if (cost <= last_) {
+      return 0;
+    }
+    return bitWidth(cost ^ last_);
+  }
+  // std::bit_width is C++20
+  static int bitWidth(frCost x)
+  {
+    return x == 0 ? 0 : num_buckets - 1 - __builtin_clz(x);
+  }
+  // Moves the grids of the lowest non-empty bucket down to the buckets of
+  // their new least cost.
+  void refill()
+  {
+    int idx = 1;
+    while (buckets_[idx].empty()) {
+      idx++;
+    }
+    auto& bucket = buckets_[idx];
+    last_ = pool_[bucket.front()].getCost();
+    for (const frUInt4 slot : bucket) {
+      last_ = std::min(last_, pool_[slot].getCost());
+    }
+    for (const frUInt4 slot : bucket) {
+      buckets_[getBucketIdx(pool_[slot].getCost())].push_back(slot);
+    }
+    bucket.clear();
+    std::make_heap(buckets_[0].begin(), buckets_[0].end(), Less{this});
+  }
+
+  std::vector<frUInt4> buckets_[num_buckets];
+  std::vector<FlexWavefrontGrid> pool_;
+  std::vector<frUInt4> free_;
+  frCost last_ = 0;
+  unsigned int size_ = 0;
+};
+
 class FlexWavefront
 {
  public:
-  bool empty() const { return wavefrontPQ_.empty(); }
-  const FlexWavefrontGrid& top() const { return wavefrontPQ_.top(); }
-  void pop() { wavefrontPQ_.pop(); }
-  void push(const FlexWavefrontGrid& in) { wavefrontPQ_.push(in); }
-  unsigned int size() const { return wavefrontPQ_.size(); }
-  void cleanup() { wavefrontPQ_.cleanup(); }
-  void fit() { wavefrontPQ_.fit(); }
+  // Selects the radix queue instead of the binary heap; the wavefront must
+  // be empty.
+  void setRadix(bool in) { radix_ = in; }
+  bool empty() const
+  {
+    return radix_ ? wavefrontRQ_.empty() : wavefrontPQ_.empty();
+  }
+  const FlexWavefrontGrid& top() const
+  {
+    return radix_ ? wavefrontRQ_.top() : wavefrontPQ_.top();
+  }
+  void pop()
+  {
+    if (radix_) {
+      wavefrontRQ_.pop();
+    } else {
+      wavefrontPQ_.pop();
+    }
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    if (radix_) {
+      wavefrontRQ_.push(in);
+    } else {
+      wavefrontPQ_.push(in);
+    }
+  }
+  unsigned int size() const
+  {
+    return radix_ ? wavefrontRQ_.size() : wavefrontPQ_.size();
+  }
+  void cleanup()
+  {
+    wavefrontPQ_.cleanup();
+    wavefrontRQ_.cleanup();
+  }
+  void fit()
+  {
+    wavefrontPQ_.fit();
+    wavefrontRQ_.fit();
+  }
 
  private:
   myPriorityQueue wavefrontPQ_;
+  myRadixQueue wavefrontRQ_;
+  bool radix_ = false;
 };
 }  // namespace drt
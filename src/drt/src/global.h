@@ -52,6 +52,12 @@ struct RouterConfiguration
   bool DO_PA = true;
   bool SINGLE_STEP_DR = false;
   bool SAVE_GUIDE_UPDATES = false;
+  // maze search wavefront as a radix queue instead of a binary heap
+  bool RADIX_WAVEFRONT = false;
+  // track assignment panels scheduled by conflict color on all threads
+  bool TA_COLOR_PANELS = false;
+  // pin access results reused between runs, empty for none
+  std::string PA_CACHE_FILE;
 
   std::string VIAINPIN_BOTTOMLAYER_NAME;
   std::string VIAINPIN_TOPLAYER_NAME;
@@ -28,6 +28,7 @@
 #include "dst/JobMessage.h"
 #include "frProfileTask.h"
 #include "gc/FlexGC.h"
+#include "pa/FlexPA_cache.h"
 #include "serialization.h"
 #include "utl/exception.h"
 
@@ -145,6 +146,71 @@ void FlexPA::applyPatternsFile(const char* file_path)
   file.close();
 }
 
+std::vector<bool> FlexPA::getSkipTerms(frInst* unique_inst)
+{
+  std::vector<bool> skip_terms;
+  skip_terms.reserve(unique_inst->getInstTerms().size());
+  for (auto& inst_term : unique_inst->getInstTerms()) {
+    skip_terms.push_back(isSkipInstTerm(inst_term.get()));
+  }
+  return skip_terms;
+}
+
+void FlexPA::loadCache()
+{
+  if (router_cfg_->PA_CACHE_FILE.empty()) {
+    return;
+  }
+  ProfileTask profile("PA:loadCache");
+  cache_ = std::make_unique<PinAccessCache>(design_, logger_, router_cfg_);
+  const int num_entries = cache_->load(router_cfg_->PA_CACHE_FILE);
+  if (router_cfg_->VERBOSE > 0) {
+    logger_->info(DRT,
+                  624,
+                  "Loaded {} pin access cache entries from {}.",
+                  num_entries,
+                  router_cfg_->PA_CACHE_FILE);
+  }
+  cache_keys_.clear();
+  num_cached_unique_insts_ = 0;
+  for (frInst* unique_inst : unique_insts_.getUnique()) {
+    cache_keys_[unique_inst]
+        = cache_->getKey(unique_inst,
+                         unique_insts_.getTrackPosition(unique_inst),
+                         getSkipTerms(unique_inst));
+  }
+}
+
+void FlexPA::saveCache()
+{
+  if (!cache_) {
+    return;
+  }
+  ProfileTask profile("PA:saveCache");
+  int num_cacheable_unique_insts = 0;
+  for (frInst* unique_inst : unique_insts_.getUnique()) {
+    if (!isStdCell(unique_inst) && !isMacroCell(unique_inst)) {
+      continue;
+    }
+    num_cacheable_unique_insts++;
+    auto it = unique_inst_patterns_.find(unique_inst);
+    cache_->add(cache_keys_.at(unique_inst),
+                unique_inst,
+                getSkipTerms(unique_inst),
+                it == unique_inst_patterns_.end() ? nullptr : &it->second);
+  }
+  cache_->save(router_cfg_->PA_CACHE_FILE);
+  if (router_cfg_->VERBOSE > 0) {
+    logger_->info(DRT,
+                  628,
+                  "Reused cached pin access of {} of {} unique instances.",
+                  num_cached_unique_insts_,
+                  num_cacheable_unique_insts);
+  }
+  cache_.reset();
+  cache_keys_.clear();
+}
+
 void FlexPA::prep()
 {
   ProfileTask profile("PA:prep");
@@ -217,7 +283,17 @@ void FlexPA::prepPattern()
       if (!isStdCell(unique_inst)) {
         continue;
       }
-      prepPatternInst(unique_inst);
+      std::vector<std::unique_ptr<FlexPinAccessPattern>> patterns;
+      if (cache_
+          && cache_->getPatterns(cache_keys_.at(unique_inst),
+                                 unique_inst,
+                                 getSkipTerms(unique_inst),
+                                 patterns)) {
+#pragma omp critical
+        unique_inst_patterns_[unique_inst] = std::move(patterns);
+      } else {
+        prepPatternInst(unique_inst);
+      }
 #pragma omp critical
       {
         cnt++;
@@ -340,7 +416,9 @@ int FlexPA::main()
   }
 
   init();
+  loadCache();
   prep();
+  saveCache();
 
   int std_cell_pin_cnt = 0;
   for (auto& inst : getDesign()->getTopBlock()->getInsts()) {
@@ -59,6 +59,7 @@ using frInstLocationSet = std::set<frInst*, frInstLocationComp>;
 
 class FlexPinAccessPattern;
 class FlexDPNode;
+class PinAccessCache;
 class AbstractPAGraphics;
 
 class FlexPA
@@ -134,6 +135,11 @@ class FlexPA
   std::string shared_vol_;
   int cloud_sz_ = -1;
 
+  // results of earlier runs, only with a pin access cache file
+  std::unique_ptr<PinAccessCache> cache_;
+  std::unordered_map<frInst*, std::string> cache_keys_;
+  int num_cached_unique_insts_ = 0;
+
   // helper functions
   frDesign* getDesign() const { return design_; }
   frTechObject* getTech() const { return design_->getTech(); }
@@ -155,6 +161,10 @@ class FlexPA
   void initViaRawPriority();
   void initAllSkipInstTerm();
   void initSkipInstTerm(frInst* unique_inst);
+  // cache
+  void loadCache();
+  void saveCache();
+  std::vector<bool> getSkipTerms(frInst* unique_inst);
   // prep
   void prep();
 
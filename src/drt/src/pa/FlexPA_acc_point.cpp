@@ -12,6 +12,7 @@
 
 #include "AbstractPAGraphics.h"
 #include "FlexPA.h"
+#include "FlexPA_cache.h"
 #include "frProfileTask.h"
 #include "gc/FlexGC.h"
 #include "utl/exception.h"
@@ -1476,7 +1477,14 @@ void FlexPA::genAllAccessPoints()
         continue;
       }
 
-      genInstAccessPoints(unique_inst);
+      if (cache_
+          && cache_->getAccessPoints(cache_keys_.at(unique_inst),
+                                     unique_inst)) {
+#pragma omp atomic
+        num_cached_unique_insts_++;
+      } else {
+        genInstAccessPoints(unique_inst);
+      }
       if (router_cfg_->VERBOSE <= 0) {
         continue;
       }
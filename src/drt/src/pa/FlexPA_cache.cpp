@@ -0,0 +1,398 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#include "pa/FlexPA_cache.h"
+
+#include <unistd.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "distributed/frArchive.h"
+#include "odb/db.h"
+#include "pa/FlexPA.h"
+#include "serialization.h"
+
+namespace drt {
+
+namespace {
+
+// bump when the layout of the file or of the cached data changes
+constexpr int cache_version = 1;
+
+// FNV-1a, stable across runs and platforms unlike std::hash.
+class Hasher
+{
+ public:
+  void add(int64_t value)
+  {
+    for (int i = 0; i < 8; i++) {
+      hash_ ^= (value >> (i * 8)) & 0xff;
+      hash_ *= 1099511628211ULL;
+    }
+  }
+  void add(const std::string& value)
+  {
+    add(static_cast<int64_t>(value.size()));
+    for (const char c : value) {
+      hash_ ^= static_cast<unsigned char>(c);
+      hash_ *= 1099511628211ULL;
+    }
+  }
+  void add(const Rect& rect)
+  {
+    add(rect.xMin());
+    add(rect.yMin());
+    add(rect.xMax());
+    add(rect.yMax());
+  }
+  void add(const frPinFig* fig)
+  {
+    add(static_cast<int64_t>(fig->typeId()));
+    if (fig->typeId() == frcPolygon) {
+      auto polygon = static_cast<const frPolygon*>(fig);
+      add(polygon->getLayerNum());
+      for (const Point& pt : polygon->getPoints()) {
+        add(pt.x());
+        add(pt.y());
+      }
+    } else {
+      if (fig->typeId() == frcRect) {
+        add(static_cast<const frRect*>(fig)->getLayerNum());
+      }
+      add(fig->getBBox());
+    }
+  }
+  uint64_t get() const { return hash_; }
+
+ private:
+  uint64_t hash_ = 14695981039346656037ULL;
+};
+
+}  // namespace
+
+template <class Archive>
+void PinAccessCache::Entry::serialize(Archive& ar, const unsigned int version)
+{
+  (ar) & pin_aps;
+  (ar) & has_patterns;
+  (ar) & patterns;
+  (ar) & boundaries;
+}
+
+PinAccessCache::PinAccessCache(frDesign* design,
+                               Logger* logger,
+                               RouterConfiguration* router_cfg)
+    : design_(design),
+      logger_(logger),
+      router_cfg_(router_cfg),
+      tech_hash_(computeTechHash())
+{
+}
+
+// must be out-of-line due to the unique_ptr
+PinAccessCache::~PinAccessCache() = default;
+
+uint64_t PinAccessCache::computeTechHash() const
+{
+  Hasher hasher;
+  hasher.add(cache_version);
+  frTechObject* tech = design_->getTech();
+  hasher.add(tech->getDBUPerUU());
+  hasher.add(tech->getManufacturingGrid());
+  for (const auto& layer : tech->getLayers()) {
+    hasher.add(layer->getName());
+    hasher.add(layer->getType().getValue());
+    hasher.add(layer->getDir().getValue());
+    hasher.add(layer->getPitch());
+    hasher.add(layer->getWidth());
+    hasher.add(layer->getMinWidth());
+  }
+  for (const auto& via_def : tech->getVias()) {
+    hasher.add(via_def->getName());
+    hasher.add(via_def->getLayer1Num());
+    hasher.add(via_def->getLayer2Num());
+    hasher.add(via_def->getLayer1ShapeBox());
+    hasher.add(via_def->getCutShapeBox());
+    hasher.add(via_def->getLayer2ShapeBox());
+  }
+  // the db tech holds every rule value the access points were checked
+  // against
+  for (const auto& layer : tech->getLayers()) {
+    if (odb::dbTechLayer* db_layer = layer->getDbLayer()) {
+      std::ostringstream db_tech;
+      db_layer->getTech()->write(db_tech);
+      hasher.add(db_tech.str());
+      break;
+    }
+  }
+
+  hasher.add(router_cfg_->DBPROCESSNODE);
+  hasher.add(router_cfg_->BOTTOM_ROUTING_LAYER);
+  hasher.add(router_cfg_->TOP_ROUTING_LAYER);
+  hasher.add(router_cfg_->VIAINPIN_BOTTOMLAYERNUM);
+  hasher.add(router_cfg_->VIAINPIN_TOPLAYERNUM);
+  hasher.add(router_cfg_->VIA_ACCESS_LAYERNUM);
+  hasher.add(router_cfg_->USENONPREFTRACKS);
+  hasher.add(router_cfg_->MINNUMACCESSPOINT_STDCELLPIN);
+  hasher.add(router_cfg_->MINNUMACCESSPOINT_MACROCELLPIN);
+  hasher.add(router_cfg_->ACCESS_PATTERN_END_ITERATION_NUM);
+  return hasher.get();
+}
+
+uint64_t PinAccessCache::computeMasterHash(frMaster* master) const
+{
+  auto it = master_hashes_.find(master);
+  if (it != master_hashes_.end()) {
+    return it->second;
+  }
+  Hasher hasher;
+  hasher.add(master->getMasterType().getValue());
+  hasher.add(master->getBBox());
+  for (const auto& term : master->getTerms()) {
+    hasher.add(term->getName());
+    hasher.add(term->getType().getValue());
+    for (const auto& pin : term->getPins()) {
+      hasher.add(static_cast<int64_t>(pin->getFigs().size()));
+      for (const auto& fig : pin->getFigs()) {
+        hasher.add(fig.get());
+      }
+    }
+  }
+  for (const auto& blockage : master->getBlockages()) {
+    hasher.add(blockage->getDesignRuleWidth());
+    for (const auto& fig : blockage->getPin()->getFigs()) {
+      hasher.add(fig.get());
+    }
+  }
+  master_hashes_[master] = hasher.get();
+  return hasher.get();
+}
+
+std::string PinAccessCache::getKey(frInst* unique_inst,
+                                   const std::vector<frCoord>& track_position,
+                                   const std::vector<bool>& skip_terms) const
+{
+  frMaster* master = unique_inst->getMaster();
+  std::string key = fmt::format("{}/{:x}/{}",
+                                master->getName(),
+                                computeMasterHash(master),
+                                unique_inst->getOrient().getString());
+  for (const frCoord coord : track_position) {
+    key += fmt::format("/{}", coord);
+  }
+  key += '/';
+  for (const bool skip : skip_terms) {
+    key += skip ? '1' : '0';
+  }
+  return key;
+}
+
+bool PinAccessCache::getAccessPoints(const std::string& key,
+                                     frInst* unique_inst) const
+{
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return false;
+  }
+  const Entry& entry = it->second;
+
+  const int pin_access_idx = unique_inst->getPinAccessIdx();
+  const dbTransform xform(Point(unique_inst->getTransform().getOffset()));
+  int pin_idx = 0;
+  for (auto& inst_term : unique_inst->getInstTerms()) {
+    for (auto& pin : inst_term->getTerm()->getPins()) {
+      auto pin_access = pin->getPinAccess(pin_access_idx);
+      for (const auto& cached_ap : entry.pin_aps[pin_idx]) {
+        auto access_point = std::make_unique<frAccessPoint>(*cached_ap);
+        Point point(access_point->getPoint());
+        xform.apply(point);
+        access_point->setPoint(point);
+        for (auto& ps : access_point->getPathSegs()) {
+          Point begin = ps.getBeginPoint();
+          Point end = ps.getEndPoint();
+          xform.apply(begin);
+          xform.apply(end);
+          ps.setPoints(begin, end);
+        }
+        pin_access->addAccessPoint(std::move(access_point));
+      }
+      pin_idx++;
+    }
+  }
+  return true;
+}
+
+bool PinAccessCache::getPatterns(
+    const std::string& key,
+    frInst* unique_inst,
+    const std::vector<bool>& skip_terms,
+    std::vector<std::unique_ptr<FlexPinAccessPattern>>& patterns) const
+{
+  auto it = entries_.find(key);
+  if (it == entries_.end() || !it->second.has_patterns) {
+    return false;
+  }
+  const Entry& entry = it->second;
+
+  // the pins a pattern has an access point for, in pattern order
+  const int pin_access_idx = unique_inst->getPinAccessIdx();
+  std::vector<frPinAccess*> pin_accesses;
+  int term_idx = 0;
+  for (auto& inst_term : unique_inst->getInstTerms()) {
+    if (skip_terms[term_idx++]) {
+      continue;
+    }
+    for (auto& pin : inst_term->getTerm()->getPins()) {
+      pin_accesses.push_back(pin->getPinAccess(pin_access_idx));
+    }
+  }
+
+  for (int i = 0; i < (int) entry.patterns.size(); i++) {
+    auto pattern = std::make_unique<FlexPinAccessPattern>();
+    const std::vector<int>& ap_idxs = entry.patterns[i];
+    for (int j = 0; j < (int) ap_idxs.size(); j++) {
+      pattern->addAccessPoint(
+          ap_idxs[j] < 0 ? nullptr
+                         : pin_accesses[j]->getAccessPoint(ap_idxs[j]));
+    }
+    const auto [left, right] = entry.boundaries[i];
+    pattern->setBoundaryAP(true,
+                           left < 0 ? nullptr : pattern->getPattern()[left]);
+    pattern->setBoundaryAP(false,
+                           right < 0 ? nullptr : pattern->getPattern()[right]);
+    pattern->updateCost();
+    patterns.push_back(std::move(pattern));
+  }
+  return true;
+}
+
+void PinAccessCache::add(
+    const std::string& key,
+    frInst* unique_inst,
+    const std::vector<bool>& skip_terms,
+    const std::vector<std::unique_ptr<FlexPinAccessPattern>>* patterns)
+{
+  Entry entry;
+  const int pin_access_idx = unique_inst->getPinAccessIdx();
+  for (auto& inst_term : unique_inst->getInstTerms()) {
+    for (auto& pin : inst_term->getTerm()->getPins()) {
+      auto& aps = entry.pin_aps.emplace_back();
+      for (const auto& access_point :
+           pin->getPinAccess(pin_access_idx)->getAccessPoints()) {
+        aps.push_back(std::make_unique<frAccessPoint>(*access_point));
+      }
+    }
+  }
+
+  if (patterns != nullptr) {
+    entry.has_patterns = true;
+    for (const auto& pattern : *patterns) {
+      const std::vector<frAccessPoint*>& aps = pattern->getPattern();
+      auto& ap_idxs = entry.patterns.emplace_back();
+      int left = -1;
+      int right = -1;
+      for (int i = 0; i < (int) aps.size(); i++) {
+        ap_idxs.push_back(aps[i] ? aps[i]->getId() : -1);
+        if (aps[i] != nullptr && aps[i] == pattern->getBoundaryAP(true)) {
+          left = i;
+        }
+        if (aps[i] != nullptr && aps[i] == pattern->getBoundaryAP(false)) {
+          right = i;
+        }
+      }
+      entry.boundaries.emplace_back(left, right);
+    }
+  }
+  entries_[key] = std::move(entry);
+}
+
+int PinAccessCache::load(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.good()) {
+    return 0;
+  }
+  try {
+    frIArchive ar(file);
+    ar.setDesign(design_);
+    registerTypes(ar);
+    uint64_t tech_hash = 0;
+    (ar) & tech_hash;
+    if (tech_hash != tech_hash_) {
+      logger_->warn(DRT,
+                    625,
+                    "Pin access cache {} was written for a different "
+                    "technology or pin access settings and is ignored.",
+                    file_name);
+      return 0;
+    }
+    int sz = 0;
+    (ar) & sz;
+    while (sz--) {
+      std::string key;
+      Entry entry;
+      (ar) & key;
+      (ar) & entry;
+      entries_[key] = std::move(entry);
+    }
+  } catch (const std::exception& ex) {
+    entries_.clear();
+    logger_->warn(
+        DRT, 626, "Failed to read pin access cache {}: {}", file_name, ex.what());
+    return 0;
+  }
+  return entries_.size();
+}
+
+void PinAccessCache::save(const std::string& file_name) const
+{
+  // Write a private file and rename it over the cache, so that runs sharing
+  // the cache never read or write a partial file.
+  const std::string tmp_name = fmt::format("{}.{}.tmp", file_name, getpid());
+  std::ofstream file(tmp_name, std::ios::binary);
+  if (!file.good()) {
+    logger_->warn(DRT, 627, "Cannot write pin access cache {}.", file_name);
+    return;
+  }
+  {
+    frOArchive ar(file);
+    registerTypes(ar);
+    uint64_t tech_hash = tech_hash_;
+    (ar) & tech_hash;
+    int sz = entries_.size();
+    (ar) & sz;
+    for (const auto& [key, entry] : entries_) {
+      (ar) & key;
+      (ar) & entry;
+    }
+  }
+  file.close();
+  std::error_code error;
+  if (file.fail()) {
+    std::filesystem::remove(tmp_name, error);
+    logger_->warn(DRT, 629, "Failed to write pin access cache {}.", tmp_name);
+    return;
+  }
+  std::filesystem::rename(tmp_name, file_name, error);
+  if (error) {
+    logger_->warn(DRT,
+                  630,
+                  "Cannot replace pin access cache {}: {}",
+                  file_name,
+                  error.message());
+    std::filesystem::remove(tmp_name, error);
+  }
+}
+
+}  // namespace drt
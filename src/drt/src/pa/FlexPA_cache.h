@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "frDesign.h"
+
+namespace drt {
+
+class FlexPinAccessPattern;
+
+// On-disk cache of the access points and access patterns of unique
+// instances.  Entries are keyed on everything the analysis of a unique
+// instance depends on: the master and its geometry, the orientation, the
+// position of the preferred tracks relative to the instance origin and the
+// terms that are skipped.  The file also records a hash of the technology
+// and of the pin access settings, and is ignored when they do not match,
+// so it can be shared between runs and between blocks using the same
+// library.  The technology hash covers every layer, via and rule value of
+// the db tech, so a cache written before a rule change is not reused.
+class PinAccessCache
+{
+ public:
+  PinAccessCache(frDesign* design,
+                 Logger* logger,
+                 RouterConfiguration* router_cfg);
+  ~PinAccessCache();
+
+  // Reads file_name if it exists; returns the number of entries loaded.
+  int load(const std::string& file_name);
+  void save(const std::string& file_name) const;
+
+  // track_position lists (layer, direction, spacing, offset) of the tracks
+  // the unique instance sees and skip_terms has one flag per inst term.
+  std::string getKey(frInst* unique_inst,
+                     const std::vector<frCoord>& track_position,
+                     const std::vector<bool>& skip_terms) const;
+
+  /**
+   * @brief Fills the pin accesses of the unique instance from the cache.
+   *
+   * The access points are placed in the frame of the instance, as they are
+   * right after generation.
+   *
+   * @returns false if the key is not cached.
+   */
+  bool getAccessPoints(const std::string& key, frInst* unique_inst) const;
+
+  /**
+   * @brief Rebuilds the access patterns of the unique instance.
+   *
+   * @returns false if the key is not cached or has no patterns.
+   */
+  bool getPatterns(
+      const std::string& key,
+      frInst* unique_inst,
+      const std::vector<bool>& skip_terms,
+      std::vector<std::unique_ptr<FlexPinAccessPattern>>& patterns) const;
+
+  // Stores the access points of the unique instance, in the frame of its
+  // master, and its patterns if it has any.
+  void add(const std::string& key,
+           frInst* unique_inst,
+           const std::vector<bool>& skip_terms,
+           const std::vector<std::unique_ptr<FlexPinAccessPattern>>* patterns);
+
+ private:
+  struct Entry
+  {
+    // per pin of the master, in term and pin order
+    std::vector<std::vector<std::unique_ptr<frAccessPoint>>> pin_aps;
+    bool has_patterns = false;
+    // per pattern, the access point idx of each pin of the terms that are
+    // not skipped or -1 if the pin has none
+    std::vector<std::vector<int>> patterns;
+    // per pattern, the positions of the left and right access points
+    std::vector<std::pair<int, int>> boundaries;
+
+    template <class Archive>
+    void serialize(Archive& ar, unsigned int version);
+  };
+
+  uint64_t computeTechHash() const;
+  uint64_t computeMasterHash(frMaster* master) const;
+
+  frDesign* design_;
+  Logger* logger_;
+  RouterConfiguration* router_cfg_;
+  uint64_t tech_hash_;
+  std::map<std::string, Entry> entries_;
+  // masters already hashed, the geometry is part of each key
+  mutable std::map<frMaster*, uint64_t> master_hashes_;
+};
+
+}  // namespace drt
@@ -144,6 +144,33 @@ UniqueInsts::InstSet& UniqueInsts::computeUniqueClass(frInst* inst)
   return master_orient_trackoffset_to_insts_[inst->getMaster()][orient][offset];
 }
 
+std::vector<frCoord> UniqueInsts::getTrackPosition(frInst* inst) const
+{
+  std::vector<frCoord> position;
+  auto it = master_to_pin_layer_range_.find(inst->getMaster());
+  if (it == master_to_pin_layer_range_.end()) {
+    return position;
+  }
+  const auto [min_layer_num, max_layer_num] = it->second;
+  const Point origin = inst->getOrigin();
+  const Rect boundary_bbox = inst->getBoundaryBBox();
+  for (auto& tp : pref_track_patterns_) {
+    if (tp->getLayerNum() < min_layer_num || tp->getLayerNum() > max_layer_num
+        || !hasTrackPattern(tp, boundary_bbox)) {
+      continue;
+    }
+    const frCoord spacing = tp->getTrackSpacing();
+    // vertical track
+    const frCoord coord = tp->isHorizontal() ? origin.x() : origin.y();
+    position.push_back(tp->getLayerNum());
+    position.push_back(tp->isHorizontal());
+    position.push_back(spacing);
+    position.push_back(((tp->getStartCoord() - coord) % spacing + spacing)
+                       % spacing);
+  }
+  return position;
+}
+
 bool UniqueInsts::addInst(frInst* inst)
 {
   if (!router_cfg_->AUTO_TAPER_NDR_NETS && isNDRInst(*inst)) {
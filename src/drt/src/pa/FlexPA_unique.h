@@ -86,6 +86,16 @@ class UniqueInsts
    */
   void forceInstAsClassHead(frInst* inst);
 
+  /**
+   * @brief Describes the preferred tracks an inst sees.
+   *
+   * Unlike the track offsets of the unique classes, the offsets are taken
+   * from the start of the track patterns so they compare across designs.
+   *
+   * @returns (layer, direction, spacing, offset) of each track pattern.
+   */
+  std::vector<frCoord> getTrackPosition(frInst* inst) const;
+
   void report() const;
   void setDesign(frDesign* design) { design_ = design; }
 
@@ -790,6 +790,8 @@ void serializeGlobals(Archive& ar, RouterConfiguration* router_cfg)
   (ar) & router_cfg->SHAPEBLOATWIDTH;
   (ar) & router_cfg->HISTCOST;
   (ar) & router_cfg->CONGCOST;
+  (ar) & router_cfg->RADIX_WAVEFRONT;
+  (ar) & router_cfg->TA_COLOR_PANELS;
 }
 
 }  // namespace drt
@@ -9,6 +9,7 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -102,7 +103,7 @@ int FlexTA::initTA_helper(int iter,
   auto& ygp = gCellPatterns.at(1);
   int sol = 0;
   numPanels = 0;
-  std::vector<std::vector<std::unique_ptr<FlexTAWorker>>> workers;
+  std::vector<std::unique_ptr<FlexTAWorker>> workers;
   if (isH) {
     for (int i = offset; i < (int) ygp.getCount(); i += size) {
       auto uworker = std::make_unique<FlexTAWorker>(
@@ -120,11 +121,7 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::HORIZONTAL);
       worker.setTAIter(iter);
-      if (workers.empty()
-          || (int) workers.back().size() >= router_cfg_->BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().emplace_back(std::move(uworker));
+      workers.push_back(std::move(uworker));
     }
   } else {
     for (int i = offset; i < (int) xgp.getCount(); i += size) {
@@ -143,42 +140,88 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::VERTICAL);
       worker.setTAIter(iter);
-      if (workers.empty()
-          || (int) workers.back().size() >= router_cfg_->BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().push_back(std::move(uworker));
+      workers.push_back(std::move(uworker));
     }
   }
 
-  omp_set_num_threads(std::min(8, router_cfg_->MAX_THREADS));
-  // parallel execution
-  // multi thread
-  for (auto& workerBatch : workers) {
-    ProfileTask profile("TA:batch");
-    utl::ThreadException exception;
+  // By default the panels run in order, in batches of BATCHSIZETA
+  // consecutive panels, so no more than BATCHSIZETA threads have work.
+  // With TA_COLOR_PANELS, panels
+  // whose extension boxes overlap read each other's assignments, so they
+  // are colored apart. Panels of one color never see each other's results
+  // and run in batches of BATCHSIZE on all threads. Either way the batches
+  // are committed in panel order, which keeps the result independent of
+  // the thread count.
+  std::vector<std::vector<int>> colors;
+  int batch_limit;
+  if (router_cfg_->TA_COLOR_PANELS) {
+    colors = colorPanels(workers);
+    batch_limit = router_cfg_->BATCHSIZE;
+    omp_set_num_threads(router_cfg_->MAX_THREADS);
+  } else {
+    colors.emplace_back(workers.size());
+    std::iota(colors.back().begin(), colors.back().end(), 0);
+    batch_limit = router_cfg_->BATCHSIZETA;
+    omp_set_num_threads(
+        std::min(router_cfg_->BATCHSIZETA, router_cfg_->MAX_THREADS));
+  }
+
+  for (const std::vector<int>& color : colors) {
+    for (size_t begin = 0; begin < color.size(); begin += batch_limit) {
+      ProfileTask profile("TA:batch");
+      const int batch_size
+          = std::min<size_t>(batch_limit, color.size() - begin);
+      utl::ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < (int) workerBatch.size(); i++) {
-      try {
-        workerBatch[i]->main_mt();
+      for (int i = 0; i < batch_size; i++) {
+        try {
+          FlexTAWorker* worker = workers[color[begin + i]].get();
+          worker->main_mt();
 #pragma omp critical
-        {
-          sol += workerBatch[i]->getNumAssigned();
-          numPanels++;
+          {
+            sol += worker->getNumAssigned();
+            numPanels++;
+          }
+        } catch (...) {
+          exception.capture();
         }
-      } catch (...) {
-        exception.capture();
+      }
+      exception.rethrow();
+      for (int i = 0; i < batch_size; i++) {
+        auto& worker = workers[color[begin + i]];
+        worker->end();
+        worker.reset();
       }
     }
-    exception.rethrow();
-    for (auto& worker : workerBatch) {
-      worker->end();
-    }
-    workerBatch.clear();
   }
   return sol;
 }
 
+std::vector<std::vector<int>> FlexTA::colorPanels(
+    const std::vector<std::unique_ptr<FlexTAWorker>>& workers)
+{
+  // The panels are parallel strips in order, so a panel can only conflict
+  // with a run of the panels just before it.
+  std::vector<std::vector<int>> colors;
+  std::vector<int> panel_color(workers.size());
+  std::vector<bool> used;
+  for (int i = 0; i < (int) workers.size(); i++) {
+    used.assign(colors.size(), false);
+    const Rect& ext_box = workers[i]->getExtBox();
+    for (int j = i - 1; j >= 0 && workers[j]->getExtBox().intersects(ext_box);
+         j--) {
+      used[panel_color[j]] = true;
+    }
+    const int color = std::find(used.begin(), used.end(), false) - used.begin();
+    if (color == (int) colors.size()) {
+      colors.emplace_back();
+    }
+    colors[color].push_back(i);
+    panel_color[i] = color;
+  }
+  return colors;
+}
+
 void FlexTA::initTA(int size)
 {
   ProfileTask profile("TA:init");
@@ -311,6 +354,7 @@ int FlexTA::main()
   ProfileTask profile("TA:main");
 
   frTime t;
+  const auto start = std::chrono::steady_clock::now();
   if (router_cfg_->VERBOSE > 0) {
     logger_->info(DRT, 181, "Start track assignment.");
   }
@@ -327,6 +371,14 @@ int FlexTA::main()
   if (router_cfg_->VERBOSE > 0) {
     logger_->info(DRT, 182, "Complete track assignment.");
   }
+  debugPrint(logger_,
+             DRT,
+             "ta_schedule",
+             1,
+             "Track assignment time {:.3f} ms",
+             std::chrono::duration<double, std::milli>(
+                 std::chrono::steady_clock::now() - start)
+                 .count());
   if (router_cfg_->VERBOSE > 0) {
     t.print(logger_);
   }
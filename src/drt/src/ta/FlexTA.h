@@ -15,6 +15,7 @@
 namespace drt {
 class FlexTAGraphics;
 class AbstractTAGraphics;
+class FlexTAWorker;
 
 class FlexTA
 {
@@ -44,6 +45,9 @@ class FlexTA
   void initTA(int size);
   void searchRepair(int iter, int size, int offset);
   int initTA_helper(int iter, int size, int offset, bool isH, int& numPanels);
+  // Groups the panels into colors of panels that do not conflict.
+  static std::vector<std::vector<int>> colorPanels(
+      const std::vector<std::unique_ptr<FlexTAWorker>>& workers);
 };
 
 class FlexTAWorker;
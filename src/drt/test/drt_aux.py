@@ -32,7 +32,9 @@ def detailed_route(
     no_pin_access=False,
     single_step_dr=False,
     min_access_points=-1,
-    save_guide_updates=False
+    save_guide_updates=False,
+    radix_wavefront=False,
+    pin_access_cache=""
 ):
     router = design.getTritonRoute()
     params = drt.ParamStruct()
@@ -55,6 +57,8 @@ def detailed_route(
     params.singleStepDR = single_step_dr
     params.minAccessPoints = min_access_points
     params.saveGuideUpdates = save_guide_updates
+    params.radixWavefront = radix_wavefront
+    params.paCacheFile = pin_access_cache
     params.num_threads = openroad.thread_count()
 
     router.setParams(params)
@@ -0,0 +1,16 @@
+# -color_ta_panels schedules track assignment differently from the default,
+# so check that it routes ispd18_sample cleanly rather than diffing against
+# ispd18_sample.defok.
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+detailed_route -output_drc results/ispd18_sample_color_ta.output.drc.rpt \
+               -output_maze results/ispd18_sample_color_ta.output.maze.log \
+               -verbose 0 \
+               -color_ta_panels
+
+check "no violations with colored TA panels" { detailed_route_num_drvs } 0
+
+exit_summary
@@ -0,0 +1,16 @@
+# -radix_wavefront may break cost ties differently from the binary heap
+# wavefront, so check that it routes ispd18_sample cleanly rather than
+# diffing against ispd18_sample.defok.
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+detailed_route -output_drc results/ispd18_sample_radix.output.drc.rpt \
+               -output_maze results/ispd18_sample_radix.output.maze.log \
+               -verbose 0 \
+               -radix_wavefront
+
+check "no violations with the radix wavefront" { detailed_route_num_drvs } 0
+
+exit_summary
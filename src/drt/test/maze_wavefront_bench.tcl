@@ -0,0 +1,39 @@
+# Micro-benchmark of the maze search wavefront over a recorded worker clip.
+# Record the clips with gcd_nangate45_dump_worker.tcl (or detailed_route_debug
+# -dump_dr on any design), then replay one clip per wavefront, e.g.
+#
+#   WORKER_DIR=workerx67200_y37800 openroad -exit maze_wavefront_bench.tcl
+#   WORKER_DIR=workerx67200_y37800 WAVEFRONT=radix \
+#     openroad -exit maze_wavefront_bench.tcl
+#
+# Only the time spent in FlexGridGraph::search is reported, not the loading,
+# initialization and checking of the worker.
+source "helpers.tcl"
+
+if { [info exists ::env(DUMP_DIR)] } {
+  set dump_dir $::env(DUMP_DIR)
+} else {
+  set dump_dir results
+}
+set worker_dir $::env(WORKER_DIR)
+if { [info exists ::env(WAVEFRONT)] } {
+  set wavefront $::env(WAVEFRONT)
+} else {
+  set wavefront heap
+}
+
+set_debug_level DRT maze_search 1
+utl::redirectStringBegin
+if { $wavefront == "radix" } {
+  detailed_route_run_worker -dump_dir $dump_dir -worker_dir $worker_dir \
+    -radix_wavefront
+} else {
+  detailed_route_run_worker -dump_dir $dump_dir -worker_dir $worker_dir
+}
+set log [utl::redirectStringEnd]
+if { ![regexp {Maze search time ([0-9.]+) ms in (\d+) searches} $log \
+         - elapsed searches] } {
+  error "No maze search time in the worker log."
+}
+puts [format "%s %s wavefront: %.1f ms in %d searches" \
+        $worker_dir $wavefront $elapsed $searches]
@@ -0,0 +1,54 @@
+# A second pin_access run with -pin_access_cache must reuse the cached
+# access of every unique instance and give the same access points.
+source "helpers.tcl"
+
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def gcd_nangate45_preroute.def
+
+proc run_pin_access { cache } {
+  utl::redirectStringBegin
+  pin_access -pin_access_cache $cache
+  set log [utl::redirectStringEnd]
+  if { ![regexp {Reused cached pin access of (\d+) of (\d+) unique} \
+           $log - reused unique] } {
+    error "No pin access cache summary in the log."
+  }
+  return [list $reused $unique]
+}
+
+# every access point of the block, then the preferred access point of every
+# pin, which is the access pattern picked for its instance
+proc dump_access { } {
+  set block [ord::get_db_block]
+  set access {}
+  foreach ap [$block getAccessPoints] {
+    lappend access [list [$ap getPoint] [[$ap getLayer] getName] \
+                      [$ap hasAccess]]
+  }
+  foreach inst [$block getInsts] {
+    foreach iterm [$inst getITerms] {
+      foreach ap [$iterm getPrefAccessPoints] {
+        lappend access [list [$inst getName] [[$iterm getMTerm] getName] \
+                          [$ap getPoint] [[$ap getLayer] getName]]
+      }
+    }
+  }
+  return $access
+}
+
+set cache [make_result_file pin_access_cache.pa]
+file delete -force $cache
+
+lassign [run_pin_access $cache] reused unique
+set reference [dump_access]
+check "first run computes every unique instance" { expr $reused } 0
+check "cache file written" { file exists $cache } 1
+
+lassign [run_pin_access $cache] reused unique
+check "second run reuses every unique instance" \
+  { expr { $unique > 0 && $reused == $unique } } 1
+check "same access points and patterns" \
+  { expr { [dump_access] == $reference } } 1
+
+exit_summary
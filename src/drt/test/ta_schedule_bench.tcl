@@ -0,0 +1,37 @@
+# Compare the default and the colored (-color_ta_panels) track assignment
+# schedules on ispd18_sample, e.g.
+#
+#   THREADS=16 openroad -exit ta_schedule_bench.tcl
+#   THREADS=16 SCHEDULE=color openroad -exit ta_schedule_bench.tcl
+#
+# Only the time spent in track assignment is reported; detailed routing
+# stops after its first iteration. The default schedule stops scaling at
+# 8 threads; the colored one keeps all threads busy.
+source "helpers.tcl"
+
+if { [info exists ::env(THREADS)] } {
+  set_thread_count $::env(THREADS)
+}
+if { [info exists ::env(SCHEDULE)] } {
+  set schedule $::env(SCHEDULE)
+} else {
+  set schedule default
+}
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set_debug_level DRT ta_schedule 1
+utl::redirectStringBegin
+if { $schedule == "color" } {
+  detailed_route -droute_end_iter 1 -verbose 0 -color_ta_panels
+} else {
+  detailed_route -droute_end_iter 1 -verbose 0
+}
+set log [utl::redirectStringEnd]
+if { ![regexp {Track assignment time ([0-9.]+) ms} $log - elapsed] } {
+  error "No track assignment time in the log."
+}
+puts [format "%s schedule on %d threads: %.1f ms" \
+        $schedule [thread_count] $elapsed]
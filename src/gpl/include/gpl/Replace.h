@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "odb/geom.h"
+
 namespace odb {
 class dbDatabase;
 class dbInst;
@@ -34,6 +37,8 @@ class PlacerBaseCommon;
 class PlacerBase;
 class NesterovBaseCommon;
 class NesterovBase;
+class NesterovBaseVars;
+class NesterovPlaceVars;
 class RouteBase;
 class TimingBase;
 
@@ -43,6 +48,29 @@ class NesterovPlace;
 using Cluster = std::vector<odb::dbInst*>;
 using Clusters = std::vector<Cluster>;
 
+// Parameters of one run of Replace::doNesterovPlaceSweep. Zero keeps the
+// global_placement setting, as does everything not listed here.
+struct NesterovSweepRun
+{
+  float targetDensity = 0;
+  float targetOverflow = 0;
+};
+
+struct NesterovSweepResult
+{
+  // settings the run used
+  float targetDensity = 0;
+  float targetOverflow = 0;
+  int64_t hpwl = 0;
+  float overflow = 0;
+  int iterations = 0;
+  bool diverged = false;
+  // id of the error that stopped the run, empty if it completed
+  std::string error;
+  // warnings the run raised, reported with the sweep summary
+  std::vector<std::string> warnings;
+};
+
 class Replace
 {
  public:
@@ -57,11 +85,29 @@ class Replace
   void reset();
 
   void doIncrementalPlace(int threads);
+  // Warm-start mode of doIncrementalPlace: only the instances inside the
+  // window are placed, either the given one or the bounding box of the
+  // unplaced instances' nets bloated by margin (dbu).
+  void setIncrementalWindow(const odb::Rect& window);
+  void setIncrementalWindowMargin(int margin);
   void doInitialPlace(int threads);
   void runMBFF(int max_sz, float alpha, float beta, int threads, int num_paths);
 
   void addPlacementCluster(const Cluster& cluster);
   int doNesterovPlace(int threads, int start_iter = 0);
+  // Designs with more placeable instances than max_gcells are first placed
+  // as clusters of instances, then declustered and refined. 0 disables.
+  void setClusteredPlaceMaxGCells(int max_gcells);
+
+  // Run one Nesterov placement per element of runs, several at once, all
+  // starting from the current placement. The runs share the PlacerBase
+  // netlist and only own their Nesterov state. Timing and routability
+  // driven modes are not used. With apply_best, the run with the lowest
+  // HPWL that did not diverge is written to the db.
+  std::vector<NesterovSweepResult> doNesterovPlaceSweep(
+      const std::vector<NesterovSweepRun>& runs,
+      int threads,
+      bool apply_best);
 
   // Initial Place param settings
   void setInitialPlaceMaxIter(int iter);
@@ -69,6 +115,7 @@ class Replace
   void setInitialPlaceMaxSolverIter(int iter);
   void setInitialPlaceMaxFanout(int fanout);
   void setInitialPlaceNetWeightScale(float scale);
+  void setInitialPlacePcg(bool pcg);
 
   void setNesterovPlaceMaxIter(int iter);
 
@@ -98,6 +145,7 @@ class Replace
 
   void setRoutabilityDrivenMode(bool mode);
   void setRoutabilityUseGrt(bool mode);
+  void setRoutabilityIncrementalGrt(bool mode);
   void setRoutabilityCheckOverflow(float overflow);
   void setRoutabilityMaxDensity(float density);
   void setRoutabilityMaxInflationIter(int iter);
@@ -110,6 +158,7 @@ class Replace
   void addTimingNetWeightOverflow(int overflow);
   void setTimingNetWeightMax(float max);
   void setKeepResizeBelowOverflow(float overflow);
+  void setTimingDrivenIncrementalThreshold(int threshold);
 
   void setDebug(int pause_iterations,
                 int update_iterations,
@@ -121,7 +170,13 @@ class Replace
                 std::string images_path);
 
  private:
+  void initPlacerBase();
+  bool doWarmStartPlace(int threads);
+  int doClusteredPlace(int threads);
+  void resetPlacers();
   bool initNesterovPlace(int threads);
+  NesterovBaseVars getNesterovBaseVars() const;
+  NesterovPlaceVars getNesterovPlaceVars() const;
 
   odb::dbDatabase* db_ = nullptr;
   sta::dbSta* sta_ = nullptr;
@@ -144,6 +199,7 @@ class Replace
   int initialPlaceMaxSolverIter_ = 100;
   int initialPlaceMaxFanout_ = 200;
   float initialPlaceNetWeightScale_ = 800;
+  bool initialPlacePcg_ = false;
 
   int total_placeable_insts_ = 0;
 
@@ -173,10 +229,18 @@ class Replace
 
   float timingNetWeightMax_ = 5;
   float keepResizeBelowOverflow_ = 1.0;
+  int timingDrivenIncrementalThreshold_ = -1;
+
+  odb::Rect incrementalWindow_;
+  bool hasIncrementalWindow_ = false;
+  int incrementalWindowMargin_ = -1;
+
+  int clusteredPlaceMaxGCells_ = 0;
 
   bool timingDrivenMode_ = true;
   bool routabilityDrivenMode_ = true;
   bool routabilityUseRudy_ = true;
+  bool routabilityIncrementalGrt_ = false;
   bool uniformTargetDensityMode_ = false;
   bool skipIoMode_ = false;
   bool disableRevertIfDiverge_ = false;
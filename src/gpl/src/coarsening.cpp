@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#include "coarsening.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "odb/db.h"
+#include "placerBase.h"
+#include "utl/Logger.h"
+
+namespace gpl {
+
+using utl::GPL;
+
+Coarsening::Coarsening(const CoarseningVars& vars,
+                       std::shared_ptr<PlacerBaseCommon> pbc,
+                       utl::Logger* logger)
+    : vars_(vars), pbc_(std::move(pbc)), log_(logger)
+{
+}
+
+Clusters Coarsening::coarsen()
+{
+  Level level;
+  std::vector<int> inst_cluster;
+  initLevel(level, inst_cluster);
+
+  const int64_t total_area
+      = std::accumulate(level.area.begin(), level.area.end(), int64_t{0});
+  const int64_t max_area = static_cast<int64_t>(
+      vars_.maxClusterAreaRatio * total_area / std::max(vars_.maxClusters, 1));
+
+  int num_vertices = level.area.size();
+  for (int i = 0; i < vars_.maxLevels && num_vertices > vars_.maxClusters;
+       ++i) {
+    std::vector<int> vertex_cluster;
+    const int num_clusters
+        = match(level, max_area, vars_.maxClusters, vertex_cluster);
+    for (int& cluster : inst_cluster) {
+      cluster = vertex_cluster[cluster];
+    }
+    Level coarse;
+    contract(level, vertex_cluster, num_clusters, coarse);
+    level = std::move(coarse);
+
+    debugPrint(log_,
+               GPL,
+               "coarsening",
+               1,
+               "Level {}: {} vertices, {} hyperedges.",
+               i + 1,
+               num_clusters,
+               level.edge_ptr.size() - 1);
+
+    const bool stalled
+        = num_vertices - num_clusters < vars_.minLevelRatio * num_vertices;
+    num_vertices = num_clusters;
+    if (stalled) {
+      break;
+    }
+  }
+
+  std::vector<Cluster> clusters(num_vertices);
+  const std::vector<Instance*>& insts = pbc_->placeInsts();
+  for (size_t i = 0; i < insts.size(); ++i) {
+    clusters[inst_cluster[i]].push_back(insts[i]->dbInst());
+  }
+  clusters.erase(
+      std::remove_if(clusters.begin(),
+                     clusters.end(),
+                     [](const Cluster& cluster) { return cluster.size() < 2; }),
+      clusters.end());
+  return clusters;
+}
+
+void Coarsening::initLevel(Level& level, std::vector<int>& inst_cluster) const
+{
+  // vertex of each placeable instance; kept aside so the extIds used by
+  // initial place are left alone
+  const std::vector<Instance*>& insts = pbc_->placeInsts();
+  std::unordered_map<const Instance*, int> inst_vertex;
+  inst_vertex.reserve(insts.size());
+  std::map<odb::dbGroup*, int> group_ids;
+  level.area.reserve(insts.size());
+  level.group.reserve(insts.size());
+  inst_cluster.resize(insts.size());
+  for (size_t i = 0; i < insts.size(); ++i) {
+    Instance* inst = insts[i];
+    inst_vertex[inst] = i;
+    inst_cluster[i] = i;
+    level.area.push_back(inst->area());
+    if (inst->isMacro() || inst->isLocked()) {
+      level.group.push_back(-1);
+    } else {
+      auto [it, inserted] = group_ids.emplace(inst->dbInst()->getGroup(),
+                                              group_ids.size());
+      level.group.push_back(it->second);
+    }
+  }
+
+  level.edge_ptr.push_back(0);
+  std::vector<int> vertices;
+  for (Net* net : pbc_->nets()) {
+    if (static_cast<int>(net->pins().size()) > vars_.maxNetDegree) {
+      continue;
+    }
+    vertices.clear();
+    for (Pin* pin : net->pins()) {
+      auto it = inst_vertex.find(pin->instance());
+      if (it != inst_vertex.end()) {
+        vertices.push_back(it->second);
+      }
+    }
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                   vertices.end());
+    if (vertices.size() < 2) {
+      continue;
+    }
+    level.edges.insert(level.edges.end(), vertices.begin(), vertices.end());
+    level.edge_ptr.push_back(level.edges.size());
+  }
+  buildVertexEdges(level);
+}
+
+void Coarsening::buildVertexEdges(Level& level)
+{
+  const int num_vertices = level.area.size();
+  const int num_edges = level.edge_ptr.size() - 1;
+  level.vertex_ptr.assign(num_vertices + 1, 0);
+  for (int v : level.edges) {
+    ++level.vertex_ptr[v + 1];
+  }
+  std::partial_sum(level.vertex_ptr.begin(),
+                   level.vertex_ptr.end(),
+                   level.vertex_ptr.begin());
+  level.vertex_edges.resize(level.edges.size());
+  std::vector<int> fill(level.vertex_ptr.begin(), level.vertex_ptr.end() - 1);
+  for (int e = 0; e < num_edges; ++e) {
+    for (int i = level.edge_ptr[e]; i < level.edge_ptr[e + 1]; ++i) {
+      level.vertex_edges[fill[level.edges[i]]++] = e;
+    }
+  }
+}
+
+int Coarsening::match(const Level& level,
+                      int64_t max_area,
+                      int max_clusters,
+                      std::vector<int>& vertex_cluster)
+{
+  const int num_vertices = level.area.size();
+  std::vector<int> order(num_vertices);
+  std::iota(order.begin(), order.end(), 0);
+  std::mt19937 rng(vars_.seed++);
+  std::shuffle(order.begin(), order.end(), rng);
+
+  vertex_cluster.assign(num_vertices, -1);
+  std::vector<int64_t> cluster_area;
+  cluster_area.reserve(num_vertices);
+  std::vector<float> score(num_vertices, 0);
+  std::vector<int> touched;
+  // Every merge removes one vertex from the coarse level.
+  int remaining = num_vertices;
+
+  for (int v : order) {
+    if (vertex_cluster[v] != -1) {
+      continue;
+    }
+    const int group = level.group[v];
+    int best = -1;
+    if (group >= 0 && remaining > max_clusters) {
+      for (int i = level.vertex_ptr[v]; i < level.vertex_ptr[v + 1]; ++i) {
+        const int e = level.vertex_edges[i];
+        const int begin = level.edge_ptr[e];
+        const int end = level.edge_ptr[e + 1];
+        const float weight = 1.0f / (end - begin - 1);
+        for (int j = begin; j < end; ++j) {
+          const int u = level.edges[j];
+          if (u == v || level.group[u] != group) {
+            continue;
+          }
+          if (score[u] == 0) {
+            touched.push_back(u);
+          }
+          score[u] += weight;
+        }
+      }
+
+      float best_rating = 0;
+      for (int u : touched) {
+        const int64_t area
+            = level.area[v]
+              + (vertex_cluster[u] == -1 ? level.area[u]
+                                         : cluster_area[vertex_cluster[u]]);
+        const float rating = score[u] / std::max(area, int64_t{1});
+        if (area <= max_area && rating > best_rating) {
+          best_rating = rating;
+          best = u;
+        }
+        score[u] = 0;
+      }
+      touched.clear();
+    }
+
+    if (best == -1) {
+      vertex_cluster[v] = cluster_area.size();
+      cluster_area.push_back(level.area[v]);
+      continue;
+    }
+    if (vertex_cluster[best] == -1) {
+      vertex_cluster[best] = cluster_area.size();
+      cluster_area.push_back(level.area[best]);
+    }
+    vertex_cluster[v] = vertex_cluster[best];
+    cluster_area[vertex_cluster[v]] += level.area[v];
+    --remaining;
+  }
+  return cluster_area.size();
+}
+
+void Coarsening::contract(const Level& level,
+                          const std::vector<int>& vertex_cluster,
+                          int num_clusters,
+                          Level& coarse) const
+{
+  const int num_vertices = level.area.size();
+  coarse.area.assign(num_clusters, 0);
+  coarse.group.assign(num_clusters, -1);
+  for (int v = 0; v < num_vertices; ++v) {
+    const int c = vertex_cluster[v];
+    coarse.area[c] += level.area[v];
+    coarse.group[c] = level.group[v];
+  }
+
+  // Parallel hyperedges are kept so that they weigh in the next level.
+  coarse.edge_ptr.push_back(0);
+  const int num_edges = level.edge_ptr.size() - 1;
+  std::vector<int> vertices;
+  for (int e = 0; e < num_edges; ++e) {
+    vertices.clear();
+    for (int i = level.edge_ptr[e]; i < level.edge_ptr[e + 1]; ++i) {
+      vertices.push_back(vertex_cluster[level.edges[i]]);
+    }
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                   vertices.end());
+    if (vertices.size() < 2) {
+      continue;
+    }
+    coarse.edges.insert(coarse.edges.end(), vertices.begin(), vertices.end());
+    coarse.edge_ptr.push_back(coarse.edges.size());
+  }
+  buildVertexEdges(coarse);
+}
+
+}  // namespace gpl
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025, The OpenROAD Authors
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gpl/Replace.h"
+
+namespace utl {
+class Logger;
+}
+
+namespace gpl {
+
+class PlacerBaseCommon;
+
+class CoarseningVars
+{
+ public:
+  // stop once the netlist has at most this many clusters
+  int maxClusters = 0;
+  // nets with more pins do not attract their instances to each other
+  int maxNetDegree = 50;
+  // upper bound of a cluster's area, in multiples of the average cluster
+  // area at maxClusters
+  float maxClusterAreaRatio = 3;
+  // stop when a level shrinks the netlist by less than this ratio
+  float minLevelRatio = 0.05;
+  int maxLevels = 20;
+  int seed = 0;
+};
+
+// Multilevel first-choice coarsening of the placeable standard cells, in
+// the manner of the par hypergraph coarsener. Each level matches every
+// vertex with the neighbor (or the neighbor's cluster) it shares the most
+// connectivity with per unit of area, then contracts the hypergraph.
+// Macros, locked instances and instances of different groups are never
+// merged.
+class Coarsening
+{
+ public:
+  Coarsening(const CoarseningVars& vars,
+             std::shared_ptr<PlacerBaseCommon> pbc,
+             utl::Logger* logger);
+
+  // Clusters of two or more instances; the others stay on their own.
+  Clusters coarsen();
+
+ private:
+  struct Level
+  {
+    std::vector<int64_t> area;
+    std::vector<int> group;
+    std::vector<int> edges;  // concatenated vertices of each hyperedge
+    std::vector<int> edge_ptr;
+    std::vector<int> vertex_edges;  // concatenated hyperedges of each vertex
+    std::vector<int> vertex_ptr;
+  };
+
+  void initLevel(Level& level, std::vector<int>& inst_cluster) const;
+  // Returns the number of clusters and the cluster of each vertex.
+  int match(const Level& level,
+            int64_t max_area,
+            int max_clusters,
+            std::vector<int>& vertex_cluster);
+  void contract(const Level& level,
+                const std::vector<int>& vertex_cluster,
+                int num_clusters,
+                Level& coarse) const;
+  static void buildVertexEdges(Level& level);
+
+  CoarseningVars vars_;
+  std::shared_ptr<PlacerBaseCommon> pbc_;
+  utl::Logger* log_ = nullptr;
+};
+
+}  // namespace gpl
@@ -0,0 +1,389 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#include "dct.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "fft.h"
+
+namespace gpl {
+
+using Complex = std::complex<double>;
+
+static bool isPowerOfTwo(int n)
+{
+  return n >= 2 && (n & (n - 1)) == 0;
+}
+
+////////////////////////////////////////////////
+// OouraDctEngine
+
+namespace {
+
+class OouraDctEngine : public DctEngine
+{
+ public:
+  explicit OouraDctEngine(int n);
+
+  void transform(DctType type, int n, float* a, DctWork& work) const override;
+
+ private:
+  // Only written while the tables are built in the constructor, after
+  // which ddct/ddst just read them.
+  mutable std::vector<float> csTable_;
+  mutable std::vector<int> workArea_;
+};
+
+OouraDctEngine::OouraDctEngine(int n)
+{
+  // Same table sizes as the 2D routines use for an n x n grid.
+  csTable_.resize(n * 3 / 2, 0);
+  workArea_.resize(std::round(std::sqrt(n)) + 2, 0);
+
+  // Build the cos/sin tables for the largest length up front so that
+  // transform() is read only and may run on several threads.
+  std::vector<float> a(n, 0);
+  ddct(n, -1, a.data(), workArea_.data(), csTable_.data());
+}
+
+void OouraDctEngine::transform(DctType type,
+                               int n,
+                               float* a,
+                               DctWork& work) const
+{
+  switch (type) {
+    case DctType::kDct:
+      ddct(n, -1, a, workArea_.data(), csTable_.data());
+      break;
+    case DctType::kIdct:
+      ddct(n, 1, a, workArea_.data(), csTable_.data());
+      break;
+    case DctType::kIdst:
+      ddst(n, 1, a, workArea_.data(), csTable_.data());
+      break;
+  }
+}
+
+////////////////////////////////////////////////
+// ComplexFft
+
+// Complex DFT of any length,
+//   X[k] = sum_j=0^n-1 x[j] * exp(-2 * pi * i * j * k / n),
+// by recursive mixed-radix decimation in time with radix 4 and 2
+// butterflies and a generic one for odd factors.
+class ComplexFft
+{
+ public:
+  explicit ComplexFft(int n);
+
+  int size() const { return n_; }
+  int maxRadix() const { return maxRadix_; }
+
+  // scratch must hold maxRadix() values.
+  void forward(const Complex* in, Complex* out, Complex* scratch) const;
+
+ private:
+  void work(Complex* out,
+            const Complex* in,
+            int stride,
+            int stage,
+            Complex* scratch) const;
+  void butterfly2(Complex* out, int stride, int m) const;
+  void butterfly4(Complex* out, int stride, int m) const;
+  void butterflyGeneric(Complex* out,
+                        int stride,
+                        int p,
+                        int m,
+                        Complex* scratch) const;
+
+  int n_;
+  int maxRadix_ = 1;
+  // n = radix_[0] * remaining_[0], remaining_[i] = radix_[i+1] * ...
+  std::vector<int> radix_;
+  std::vector<int> remaining_;
+  std::vector<Complex> twiddles_;
+};
+
+ComplexFft::ComplexFft(int n) : n_(n)
+{
+  twiddles_.resize(n);
+  for (int i = 0; i < n; i++) {
+    twiddles_[i] = std::polar(1.0, -2.0 * M_PI * i / n);
+  }
+
+  int m = n;
+  int p = 4;
+  while (m > 1) {
+    while (m % p != 0) {
+      switch (p) {
+        case 4:
+          p = 2;
+          break;
+        case 2:
+          p = 3;
+          break;
+        default:
+          p += 2;
+          break;
+      }
+      if (p * p > m) {
+        p = m;  // m is prime
+      }
+    }
+    m /= p;
+    radix_.push_back(p);
+    remaining_.push_back(m);
+    maxRadix_ = std::max(maxRadix_, p);
+  }
+}
+
+void ComplexFft::forward(const Complex* in,
+                         Complex* out,
+                         Complex* scratch) const
+{
+  if (n_ == 1) {
+    out[0] = in[0];
+    return;
+  }
+  work(out, in, 1, 0, scratch);
+}
+
+void ComplexFft::work(Complex* out,
+                      const Complex* in,
+                      int stride,
+                      int stage,
+                      Complex* scratch) const
+{
+  const int p = radix_[stage];
+  const int m = remaining_[stage];
+  if (m == 1) {
+    for (int i = 0; i < p; i++) {
+      out[i] = in[i * stride];
+    }
+  } else {
+    for (int i = 0; i < p; i++) {
+      work(out + i * m, in + i * stride, stride * p, stage + 1, scratch);
+    }
+  }
+
+  switch (p) {
+    case 2:
+      butterfly2(out, stride, m);
+      break;
+    case 4:
+      butterfly4(out, stride, m);
+      break;
+    default:
+      butterflyGeneric(out, stride, p, m, scratch);
+      break;
+  }
+}
+
+void ComplexFft::butterfly2(Complex* out, int stride, int m) const
+{
+  Complex* out2 = out + m;
+  for (int k = 0; k < m; k++) {
+    const Complex t = out2[k] * twiddles_[k * stride];
+    out2[k] = out[k] - t;
+    out[k] += t;
+  }
+}
+
+void ComplexFft::butterfly4(Complex* out, int stride, int m) const
+{
+  for (int k = 0; k < m; k++) {
+    const Complex s0 = out[k + m] * twiddles_[k * stride];
+    const Complex s1 = out[k + 2 * m] * twiddles_[2 * k * stride];
+    const Complex s2 = out[k + 3 * m] * twiddles_[3 * k * stride];
+    const Complex s5 = out[k] - s1;
+    out[k] += s1;
+    const Complex s3 = s0 + s2;
+    const Complex s4 = s0 - s2;
+    out[k + 2 * m] = out[k] - s3;
+    out[k] += s3;
+    out[k + m] = {s5.real() + s4.imag(), s5.imag() - s4.real()};
+    out[k + 3 * m] = {s5.real() - s4.imag(), s5.imag() + s4.real()};
+  }
+}
+
+void ComplexFft::butterflyGeneric(Complex* out,
+                                  int stride,
+                                  int p,
+                                  int m,
+                                  Complex* scratch) const
+{
+  for (int u = 0; u < m; u++) {
+    for (int q = 0, k = u; q < p; q++, k += m) {
+      scratch[q] = out[k];
+    }
+    for (int q1 = 0, k = u; q1 < p; q1++, k += m) {
+      int twiddle = 0;
+      out[k] = scratch[0];
+      for (int q = 1; q < p; q++) {
+        twiddle += stride * k;
+        if (twiddle >= n_) {
+          twiddle -= n_;
+        }
+        out[k] += scratch[q] * twiddles_[twiddle];
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////
+// MixedRadixDctEngine
+
+// DCT of any length through a complex FFT of the same length after
+// reordering the input (J. Makhoul, "A fast cosine transform in one and
+// two dimensions", 1980).
+class DctPlan
+{
+ public:
+  explicit DctPlan(int n);
+
+  int size() const { return fft_.size(); }
+  void transform(DctType type, float* a, DctWork& work) const;
+
+ private:
+  void dct(float* a, DctWork& work) const;
+  void idct(float* a, DctWork& work) const;
+
+  ComplexFft fft_;
+  // exp(-i * pi * k / 2n)
+  std::vector<Complex> shift_;
+};
+
+DctPlan::DctPlan(int n) : fft_(n)
+{
+  shift_.resize(n);
+  for (int k = 0; k < n; k++) {
+    shift_[k] = std::polar(1.0, -M_PI * k / (2.0 * n));
+  }
+}
+
+void DctPlan::transform(DctType type, float* a, DctWork& work) const
+{
+  const int n = size();
+  work.complex.resize(n);
+  work.complex2.resize(n + fft_.maxRadix());
+
+  switch (type) {
+    case DctType::kDct:
+      dct(a, work);
+      break;
+    case DctType::kIdct:
+      idct(a, work);
+      break;
+    case DctType::kIdst: {
+      // sin(pi * j * (k + 1/2) / n)
+      //   = (-1)^k * cos(pi * (n - j) * (k + 1/2) / n)
+      // so the IDST is an IDCT of the reversed input with odd outputs
+      // negated.
+      work.real.resize(n);
+      float* b = work.real.data();
+      b[0] = a[0];
+      for (int j = 1; j < n; j++) {
+        b[j] = a[n - j];
+      }
+      idct(b, work);
+      for (int k = 0; k < n; k++) {
+        a[k] = (k % 2 == 0) ? b[k] : -b[k];
+      }
+      break;
+    }
+  }
+}
+
+void DctPlan::dct(float* a, DctWork& work) const
+{
+  const int n = size();
+  Complex* v = work.complex.data();
+  Complex* spectrum = work.complex2.data();
+  Complex* scratch = spectrum + n;
+
+  for (int j = 0; 2 * j < n; j++) {
+    v[j] = a[2 * j];
+  }
+  for (int j = 0; 2 * j + 1 < n; j++) {
+    v[n - 1 - j] = a[2 * j + 1];
+  }
+  fft_.forward(v, spectrum, scratch);
+  for (int k = 0; k < n; k++) {
+    a[k] = (spectrum[k] * shift_[k]).real();
+  }
+}
+
+void DctPlan::idct(float* a, DctWork& work) const
+{
+  const int n = size();
+  Complex* spectrum = work.complex.data();
+  Complex* v = work.complex2.data();
+  Complex* scratch = v + n;
+
+  // Undo the output stage of dct() (where a[0] counts twice), then invert
+  // the FFT as conj(fft(conj(x))) without the 1/n scale.
+  spectrum[0] = 2.0 * a[0];
+  for (int k = 1; k < n; k++) {
+    spectrum[k] = std::conj(std::conj(shift_[k]) * Complex(a[k], -a[n - k]));
+  }
+  fft_.forward(spectrum, v, scratch);
+  for (int j = 0; 2 * j < n; j++) {
+    a[2 * j] = 0.5 * v[j].real();
+  }
+  for (int j = 0; 2 * j + 1 < n; j++) {
+    a[2 * j + 1] = 0.5 * v[n - 1 - j].real();
+  }
+}
+
+class MixedRadixDctEngine : public DctEngine
+{
+ public:
+  MixedRadixDctEngine(int n1, int n2);
+
+  void transform(DctType type, int n, float* a, DctWork& work) const override;
+
+ private:
+  DctPlan plan1_;
+  std::unique_ptr<DctPlan> plan2_;
+};
+
+MixedRadixDctEngine::MixedRadixDctEngine(int n1, int n2) : plan1_(n1)
+{
+  if (n2 != n1) {
+    plan2_ = std::make_unique<DctPlan>(n2);
+  }
+}
+
+void MixedRadixDctEngine::transform(DctType type,
+                                    int n,
+                                    float* a,
+                                    DctWork& work) const
+{
+  if (n == plan1_.size()) {
+    plan1_.transform(type, a, work);
+  } else {
+    plan2_->transform(type, a, work);
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<DctEngine> DctEngine::create(int n1, int n2)
+{
+  if (isPowerOfTwo(n1) && isPowerOfTwo(n2)) {
+    return std::make_unique<OouraDctEngine>(std::max(n1, n2));
+  }
+  return createMixedRadix(n1, n2);
+}
+
+std::unique_ptr<DctEngine> DctEngine::createMixedRadix(int n1, int n2)
+{
+  return std::make_unique<MixedRadixDctEngine>(n1, n2);
+}
+
+}  // namespace gpl
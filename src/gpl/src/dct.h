@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#pragma once
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+namespace gpl {
+
+// Real-to-real 1D transforms used by the electrostatic (Poisson) solver,
+// with the conventions of Ooura's ddct/ddst (see fftsg.cpp):
+//
+//   kDct:  C[k] = sum_j=0^n-1 a[j] * cos(pi * (j + 1/2) * k / n)
+//   kIdct: C[k] = sum_j=0^n-1 a[j] * cos(pi * j * (k + 1/2) / n)
+//   kIdst: S[k] = sum_j=1^n   A[j] * sin(pi * j * (k + 1/2) / n)
+//          where A[j] = a[j] for 0 < j < n and A[n] = a[0].
+enum class DctType
+{
+  kDct,
+  kIdct,
+  kIdst
+};
+
+// Per thread scratch space of a DctEngine.
+struct DctWork
+{
+  std::vector<float> real;
+  std::vector<std::complex<double>> complex;
+  std::vector<std::complex<double>> complex2;
+};
+
+class DctEngine
+{
+ public:
+  virtual ~DctEngine() = default;
+
+  // Transform the n values at a in place. n must be one of the lengths
+  // given to create(). Safe to call concurrently with different work.
+  virtual void transform(DctType type, int n, float* a, DctWork& work) const
+      = 0;
+
+  // Engine for lengths n1 and n2. Powers of two use Ooura's split-radix
+  // transforms, other lengths a mixed-radix FFT.
+  static std::unique_ptr<DctEngine> create(int n1, int n2);
+  static std::unique_ptr<DctEngine> createMixedRadix(int n1, int n2);
+};
+
+}  // namespace gpl
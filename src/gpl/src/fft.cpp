@@ -3,49 +3,48 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <utility>
+#include <vector>
+
+#include "dct.h"
 
 #define REPLACE_FFT_PI 3.141592653589793238462L
 
 namespace gpl {
 
-FFT::FFT(int binCntX, int binCntY, float binSizeX, float binSizeY)
+FFT::FFT(int binCntX,
+         int binCntY,
+         float binSizeX,
+         float binSizeY,
+         int numThreads)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
-      binSizeY_(binSizeY)
+      binSizeY_(binSizeY),
+      numThreads_(std::max(numThreads, 1))
 {
-  binDensity_ = new float*[binCntX_];
-  electroPhi_ = new float*[binCntX_];
-  electroForceX_ = new float*[binCntX_];
-  electroForceY_ = new float*[binCntX_];
-
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i] = new float[binCntY_];
-    electroPhi_[i] = new float[binCntY_];
-    electroForceX_[i] = new float[binCntY_];
-    electroForceY_[i] = new float[binCntY_];
-
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] = electroPhi_[i][j] = electroForceX_[i][j]
-          = electroForceY_[i][j] = 0.0f;
-    }
-  }
+  const int binCnt = binCntX_ * binCntY_;
+  binDensity_.resize(binCnt, 0);
+  electroPhi_.resize(binCnt, 0);
+  electroForceX_.resize(binCnt, 0);
+  electroForceY_.resize(binCnt, 0);
 
-  csTable_.resize(std::max(binCntX_, binCntY_) * 3 / 2, 0);
+  engine_ = DctEngine::create(binCntX_, binCntY_);
+  work_.resize(numThreads_);
+  columns_.resize(numThreads_);
 
   wx_.resize(binCntX_, 0);
   wxSquare_.resize(binCntX_, 0);
   wy_.resize(binCntY_, 0);
   wySquare_.resize(binCntY_, 0);
 
-  workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
-
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -60,68 +59,76 @@ FFT::FFT(int binCntX, int binCntY, float binSizeX, float binSizeY)
   }
 }
 
-FFT::~FFT()
-{
-  using std::vector;
-  for (int i = 0; i < binCntX_; i++) {
-    delete[] binDensity_[i];
-    delete[] electroPhi_[i];
-    delete[] electroForceX_[i];
-    delete[] electroForceY_[i];
-  }
-  delete[] binDensity_;
-  delete[] electroPhi_;
-  delete[] electroForceX_;
-  delete[] electroForceY_;
-
-  csTable_.clear();
-  wx_.clear();
-  wxSquare_.clear();
-  wy_.clear();
-  wySquare_.clear();
-
-  workArea_.clear();
-}
+FFT::~FFT() = default;
 
 void FFT::updateDensity(int x, int y, float density)
 {
-  binDensity_[x][y] = density;
+  binDensity_[x * binCntY_ + y] = density;
 }
 
 std::pair<float, float> FFT::getElectroForce(int x, int y) const
 {
-  return std::make_pair(electroForceX_[x][y], electroForceY_[x][y]);
+  const int idx = x * binCntY_ + y;
+  return std::make_pair(electroForceX_[idx], electroForceY_[idx]);
 }
 
 float FFT::getElectroPhi(int x, int y) const
 {
-  return electroPhi_[x][y];
+  return electroPhi_[x * binCntY_ + y];
 }
 
-void FFT::doFFT()
+void FFT::transform2d(std::vector<float>& a, DctType rowType, DctType colType)
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         nullptr,
-         workArea_.data(),
-         csTable_.data());
-
+  // Rows are contiguous and transformed in place.
+#pragma omp parallel for num_threads(numThreads_)
   for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i][0] *= 0.5;
+    engine_->transform(
+        rowType, binCntY_, &a[i * binCntY_], work_[omp_get_thread_num()]);
   }
 
-  for (int i = 0; i < binCntY_; i++) {
-    binDensity_[0][i] *= 0.5;
+  // Columns are strided, so gather a block of them into contiguous
+  // scratch, transform, and scatter back.
+  constexpr int kBlock = 16;
+  const int blockCnt = (binCntY_ + kBlock - 1) / kBlock;
+#pragma omp parallel for num_threads(numThreads_)
+  for (int b = 0; b < blockCnt; b++) {
+    const int thread = omp_get_thread_num();
+    std::vector<float>& cols = columns_[thread];
+    cols.resize(kBlock * binCntX_);
+    const int j0 = b * kBlock;
+    const int width = std::min(kBlock, binCntY_ - j0);
+    for (int i = 0; i < binCntX_; i++) {
+      const float* row = &a[i * binCntY_ + j0];
+      for (int c = 0; c < width; c++) {
+        cols[c * binCntX_ + i] = row[c];
+      }
+    }
+    for (int c = 0; c < width; c++) {
+      engine_->transform(
+          colType, binCntX_, &cols[c * binCntX_], work_[thread]);
+    }
+    for (int i = 0; i < binCntX_; i++) {
+      float* row = &a[i * binCntY_ + j0];
+      for (int c = 0; c < width; c++) {
+        row[c] = cols[c * binCntX_ + i];
+      }
+    }
   }
+}
+
+void FFT::doFFT()
+{
+  transform2d(binDensity_, DctType::kDct, DctType::kDct);
 
   for (int i = 0; i < binCntX_; i++) {
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
-    }
+    binDensity_[i * binCntY_] *= 0.5;
+  }
+
+  for (int i = 0; i < binCntY_; i++) {
+    binDensity_[i] *= 0.5;
   }
 
+#pragma omp parallel for num_threads(numThreads_)
   for (int i = 0; i < binCntX_; i++) {
     float wx = wx_[i];
     float wx2 = wxSquare_[i];
@@ -130,7 +137,9 @@ void FFT::doFFT()
       float wy = wy_[j];
       float wy2 = wySquare_[j];
 
-      float density = binDensity_[i][j];
+      const int idx = i * binCntY_ + j;
+      binDensity_[idx] *= 4.0 / binCntX_ / binCntY_;
+      float density = binDensity_[idx];
       float phi = 0;
       float electroX = 0, electroY = 0;
 
@@ -152,33 +161,15 @@ void FFT::doFFT()
         electroX = phi * wx;
         electroY = phi * wy;
       }
-      electroPhi_[i][j] = phi;
-      electroForceX_[i][j] = electroX;
-      electroForceY_[i][j] = electroY;
+      electroPhi_[idx] = phi;
+      electroForceX_[idx] = electroX;
+      electroForceY_[idx] = electroY;
     }
   }
-  // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         nullptr,
-         workArea_.data(),
-         csTable_.data());
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          nullptr,
-          workArea_.data(),
-          csTable_.data());
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          nullptr,
-          workArea_.data(),
-          csTable_.data());
+  // Inverse DCT; x is the column direction and y the row direction.
+  transform2d(electroPhi_, DctType::kIdct, DctType::kIdct);
+  transform2d(electroForceX_, DctType::kIdct, DctType::kIdst);
+  transform2d(electroForceY_, DctType::kIdst, DctType::kIdct);
 }
 
 }  // namespace gpl
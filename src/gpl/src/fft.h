@@ -3,15 +3,22 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "dct.h"
+
 namespace gpl {
 
 class FFT
 {
  public:
-  FFT(int binCntX, int binCntY, float binSizeX, float binSizeY);
+  FFT(int binCntX,
+      int binCntY,
+      float binSizeX,
+      float binSizeY,
+      int numThreads = 1);
   ~FFT();
 
   // input func
@@ -25,16 +32,21 @@ class FFT
   float getElectroPhi(int x, int y) const;
 
  private:
-  // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
-  float** binDensity_ = nullptr;
-  float** electroPhi_ = nullptr;
-  float** electroForceX_ = nullptr;
-  float** electroForceY_ = nullptr;
+  // Transform every row (along y) with rowType, then every column
+  // (along x) with colType.
+  void transform2d(std::vector<float>& a, DctType rowType, DctType colType);
+
+  // binCntX_ x binCntY_ arrays stored row major, index x * binCntY_ + y.
+  std::vector<float> binDensity_;
+  std::vector<float> electroPhi_;
+  std::vector<float> electroForceX_;
+  std::vector<float> electroForceY_;
+
+  std::unique_ptr<DctEngine> engine_;
 
-  // cos/sin table (prev: w_2d)
-  // length:  max(binCntX, binCntY) * 3 / 2
-  std::vector<float> csTable_;
+  // Per thread scratch for engine_ and the column gathers.
+  std::vector<DctWork> work_;
+  std::vector<std::vector<float>> columns_;
 
   // wx. length:  binCntX_
   std::vector<float> wx_;
@@ -44,14 +56,11 @@ class FFT
   std::vector<float> wy_;
   std::vector<float> wySquare_;
 
-  // work area for bit reversal (prev: ip)
-  // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
-  std::vector<int> workArea_;
-
   int binCntX_ = 0;
   int binCntY_ = 0;
   float binSizeX_ = 0;
   float binSizeY_ = 0;
+  int numThreads_ = 1;
 };
 
 //
@@ -64,14 +73,6 @@ void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
 
-/// 2D FFT ////////////////////////////////////////////////////////////////
-void cdft2d(int, int, int, float**, float*, int*, float*);
-void rdft2d(int, int, int, float**, float*, int*, float*);
-void ddct2d(int, int, int, float**, float*, int*, float*);
-void ddst2d(int, int, int, float**, float*, int*, float*);
-void ddsct2d(int n1, int n2, int isgn, float** a, float* t, int* ip, float* w);
-void ddcst2d(int n1, int n2, int isgn, float** a, float* t, int* ip, float* w);
-
 /// 3D FFT ////////////////////////////////////////////////////////////////
 void cdft3d(int, int, int, int, float***, float*, int*, float*);
 void rdft3d(int, int, int, int, float***, float*, int*, float*);
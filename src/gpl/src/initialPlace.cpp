@@ -29,6 +29,7 @@ void InitialPlaceVars::reset()
   maxSolverIter = 100;
   maxFanout = 200;
   netWeightScale = 800.0;
+  pcg = false;
   debug = false;
 }
 
@@ -66,7 +67,8 @@ void InitialPlace::doBicgstabPlace(int threads)
                            fixedInstForceVecY_,
                            instLocVecY_,
                            log_,
-                           threads);
+                           threads,
+                           ipVars_.pcg);
     float error_max = std::max(error.x, error.y);
     log_->report(
         "[InitialPlace]  Iter: {} conjugate gradient residual: {:0.8f} HPWL: "
@@ -192,6 +194,42 @@ void InitialPlace::updatePinInfo()
   }
 }
 
+// The B2B pairs only change with the boundary pins of the nets, so the
+// values are added in place when all triplets fall on the current sparsity
+// pattern. Otherwise the matrix is rebuilt on the union of both patterns,
+// which settles after a few iterations.
+static void updateSparseMatrix(SMatrix& matrix, std::vector<T>& list)
+{
+  if (matrix.isCompressed() && matrix.nonZeros() > 0) {
+    const int* outer = matrix.outerIndexPtr();
+    const int* inner = matrix.innerIndexPtr();
+    float* values = matrix.valuePtr();
+    std::fill(values, values + matrix.nonZeros(), 0.0f);
+
+    bool fits = true;
+    for (const T& triplet : list) {
+      const int* begin = inner + outer[triplet.row()];
+      const int* end = inner + outer[triplet.row() + 1];
+      const int* it = std::lower_bound(begin, end, triplet.col());
+      if (it == end || *it != triplet.col()) {
+        fits = false;
+        break;
+      }
+      values[it - inner] += triplet.value();
+    }
+    if (fits) {
+      return;
+    }
+
+    for (int row = 0; row < matrix.outerSize(); row++) {
+      for (SMatrix::InnerIterator it(matrix, row); it; ++it) {
+        list.emplace_back(row, it.col(), 0.0f);
+      }
+    }
+  }
+  matrix.setFromTriplets(list.begin(), list.end());
+}
+
 // solve placeInstForceMatrixX_ * xcg_x_ = xcg_b_ and placeInstForceMatrixY_ *
 // ycg_x_ = ycg_b_ eq.
 void InitialPlace::createSparseMatrix()
@@ -202,8 +240,10 @@ void InitialPlace::createSparseMatrix()
   instLocVecY_.resize(placeCnt);
   fixedInstForceVecY_.resize(placeCnt);
 
-  placeInstForceMatrixX_.resize(placeCnt, placeCnt);
-  placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  if (placeInstForceMatrixX_.rows() != placeCnt) {
+    placeInstForceMatrixX_.resize(placeCnt, placeCnt);
+    placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  }
 
   //
   // listX and listY is a temporary vector that have tuples, (idx1, idx2, val)
@@ -215,9 +255,10 @@ void InitialPlace::createSparseMatrix()
   // to fill in SparseMatrix from Eigen docs.
   //
 
-  std::vector<T> listX, listY;
-  listX.reserve(1000000);
-  listY.reserve(1000000);
+  std::vector<T>& listX = listX_;
+  std::vector<T>& listY = listY_;
+  listX.clear();
+  listY.clear();
 
   // initialize vector
   for (auto& inst : pbc_->placeInsts()) {
@@ -367,8 +408,8 @@ void InitialPlace::createSparseMatrix()
     }
   }
 
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+  updateSparseMatrix(placeInstForceMatrixX_, listX);
+  updateSparseMatrix(placeInstForceMatrixY_, listY);
 }
 
 void InitialPlace::updateCoordi()
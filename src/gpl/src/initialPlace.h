@@ -28,6 +28,7 @@ class InitialPlaceVars
   int maxSolverIter;
   int maxFanout;
   float netWeightScale;
+  bool pcg;
   bool debug;
 
   InitialPlaceVars();
@@ -75,11 +76,15 @@ class InitialPlace
   //        SparseMatrix that contains connectivity forces on Y // B2B model is
   //        used
   //
-  // Used the interative BiCGSTAB solver to solve matrix eqs.
+  // The matrix eqs. are solved with BiCGSTAB by default, or with the Jacobi
+  // preconditioned CG solver if -initial_place_pcg is given (see
+  // solver.cpp).
 
   Eigen::VectorXf instLocVecX_, fixedInstForceVecX_;
   Eigen::VectorXf instLocVecY_, fixedInstForceVecY_;
   SMatrix placeInstForceMatrixX_, placeInstForceMatrixY_;
+  // Triplet buffers kept between iterations to reuse their memory.
+  std::vector<Eigen::Triplet<float>> listX_, listY_;
 
   void placeInstsCenter();
   void setPlaceInstExtId();
@@ -8,9 +8,11 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -77,6 +79,26 @@ struct Flop
   }
 };
 
+struct MBFF::Partition
+{
+  Mask array_mask;
+  // norm_power_ of the partition's flops, see SetRatios
+  std::vector<float> norm_power;
+};
+
+struct MBFF::PointsetTask
+{
+  int partition;
+  std::vector<Flop> flops;
+  // start_trays[i][j]: start trays of size 2^i for multistart j
+  std::vector<std::vector<std::vector<Tray>>> start_trays;
+
+  std::vector<Tray> final_trays;
+  std::vector<std::pair<int, int>> mapping;
+  std::map<int, int> tray_sizes_used;
+  double cost = 0;
+};
+
 // Get the function for a port.  If the port has no function then check
 // the parent bus/bundle, if any.  This covers:
 //    bundle (QN) {
@@ -964,7 +986,10 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
                     std::vector<std::pair<int, int>>& final_flop_to_slot,
                     const float alpha,
                     const float beta,
-                    const Mask& array_mask)
+                    const Mask& array_mask,
+                    const std::vector<float>& norm_power,
+                    const int num_workers,
+                    std::map<int, int>& tray_sizes_used)
 {
   namespace sat = operations_research::sat;
   using operations_research::Domain;
@@ -1180,7 +1205,78 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
     if (GetBitCnt(bit_idx) == 1) {
       tray_cost[i] = 1.00;
     } else {
-      tray_cost[i] = (GetBitCnt(bit_idx) * norm_power_[bit_idx]);
+      tray_cost[i] = (GetBitCnt(bit_idx) * norm_power[bit_idx]);
+    }
+  }
+
+  // Warm start: every flop goes to its slot of the tray size whose
+  // capacitated K-means clustering costs the least on its own, or to its
+  // 1-bit tray where that size has no slot for it.
+  std::map<int, std::vector<int>> choice_by_size;
+  for (int i = 0; i < num_flops; i++) {
+    for (size_t j = 0; j < cand_tray[i].size(); j++) {
+      const int size = trays[cand_tray[i][j]].slots.size();
+      std::vector<int>& choice = choice_by_size[size];
+      choice.resize(num_flops, -1);
+      if (choice[i] < 0) {
+        choice[i] = j;
+      }
+    }
+  }
+  const std::vector<int>* hint = nullptr;
+  float best_hint_cost = std::numeric_limits<float>::max();
+  for (auto& [size, choice] : choice_by_size) {
+    float cost = 0;
+    std::set<int> used_trays;
+    for (int i = 0; i < num_flops; i++) {
+      if (choice[i] < 0) {
+        cost += alpha;
+        continue;
+      }
+      const int tray_idx = cand_tray[i][choice[i]];
+      const Point& slot = trays[tray_idx].slots[cand_slot[i][choice[i]]];
+      cost += std::abs(slot.x - flops[i].pt.x)
+              + std::abs(slot.y - flops[i].pt.y);
+      if (used_trays.insert(tray_idx).second) {
+        cost += alpha * tray_cost[tray_idx];
+      }
+    }
+    if (cost < best_hint_cost) {
+      best_hint_cost = cost;
+      hint = &choice;
+    }
+  }
+  if (hint != nullptr) {
+    std::vector<bool> hint_tray_used(num_trays, false);
+    for (int i = 0; i < num_flops; i++) {
+      int hint_idx = (*hint)[i];
+      if (hint_idx < 0) {
+        // the 1-bit tray of the flop
+        for (size_t j = 0; j < cand_tray[i].size(); j++) {
+          if (trays[cand_tray[i][j]].slots.size() == 1) {
+            hint_idx = j;
+          }
+        }
+      }
+      for (size_t j = 0; j < cand_tray[i].size(); j++) {
+        const bool is_mapped = (static_cast<int>(j) == hint_idx);
+        const Point& slot = trays[cand_tray[i][j]].slots[cand_slot[i][j]];
+        cp_model.AddHint(mapped[i][j], is_mapped);
+        cp_model.AddHint(
+            disp_x[i][j],
+            is_mapped ? std::abs(int(multiplier_ * (slot.x - flops[i].pt.x)))
+                      : 0);
+        cp_model.AddHint(
+            disp_y[i][j],
+            is_mapped ? std::abs(int(multiplier_ * (slot.y - flops[i].pt.y)))
+                      : 0);
+        if (is_mapped) {
+          hint_tray_used[cand_tray[i][j]] = true;
+        }
+      }
+    }
+    for (int i = 0; i < num_trays; i++) {
+      cp_model.AddHint(tray_used[i], hint_tray_used[i]);
     }
   }
 
@@ -1213,6 +1309,7 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
 
   sat::Model model;
   sat::SatParameters parameters;
+  parameters.set_num_workers(num_workers);
   model.Add(NewSatParameters(parameters));
   sat::CpSolverResponse response = sat::SolveCpModel(cp_model.Build(), &model);
 
@@ -1238,7 +1335,7 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
     }
 
     for (const auto& sizes : trays_used) {
-      tray_sizes_used_[sizes.second]++;
+      tray_sizes_used[sizes.second]++;
     }
 
     return ret;
@@ -1944,24 +2041,22 @@ void MBFF::displayFlopClusters(const char* stage,
   }
 }
 
-float MBFF::RunClustering(const std::vector<Flop>& flops,
-                          const int mx_sz,
-                          const float alpha,
-                          const float beta,
-                          const Mask& array_mask)
+void MBFF::GetPointsetTasks(const std::vector<Flop>& flops,
+                            const int mx_sz,
+                            const Mask& array_mask,
+                            const int partition,
+                            std::vector<PointsetTask>& tasks)
 {
   std::vector<std::vector<Flop>> pointsets;
   KMeansDecomp(flops, mx_sz, pointsets);
 
   displayFlopClusters("Point sets", pointsets);
 
-  // all_start_trays[t][i][j]: start trays of size 2^i, multistart = j for
-  // pointset[t]
-  const int num_pointsets = pointsets.size();
-  std::vector<std::vector<std::vector<std::vector<Tray>>>> all_start_trays(
-      num_pointsets);
-  for (int t = 0; t < num_pointsets; t++) {
-    all_start_trays[t].resize(num_sizes_);
+  for (std::vector<Flop>& pointset : pointsets) {
+    PointsetTask task;
+    task.partition = partition;
+    task.flops = std::move(pointset);
+    task.start_trays.resize(num_sizes_);
     for (int i = 1; i < num_sizes_; i++) {
       if (best_master_[array_mask][i] != nullptr) {
         const int rows = GetRows(GetBitCnt(i), array_mask);
@@ -1969,95 +2064,95 @@ float MBFF::RunClustering(const std::vector<Flop>& flops,
         const float AR = (cols * single_bit_width_ * norm_area_[i])
                          / (rows * single_bit_height_);
         const int num_trays
-            = (pointsets[t].size() + (GetBitCnt(i) - 1)) / GetBitCnt(i);
-        all_start_trays[t][i].resize(5);
+            = (task.flops.size() + (GetBitCnt(i) - 1)) / GetBitCnt(i);
+        task.start_trays[i].resize(5);
         for (int j = 0; j < 5; j++) {
-          // running in parallel ==> not reproducible
-          GetStartTrays(pointsets[t], num_trays, AR, all_start_trays[t][i][j]);
+          // std::rand is drawn here, serially, so the start trays do not
+          // depend on how the tasks are later spread over the threads
+          GetStartTrays(task.flops, num_trays, AR, task.start_trays[i][j]);
         }
       }
     }
+    tasks.push_back(std::move(task));
   }
+}
 
-  float ans = 0;
-  std::vector<std::vector<std::pair<int, int>>> all_mappings(num_pointsets);
-  std::vector<std::vector<Tray>> all_final_trays(num_pointsets);
-
-#pragma omp parallel for num_threads(num_threads_)
-  for (int t = 0; t < num_pointsets; t++) {
-    std::vector<std::vector<Tray>> cur_trays;
-    RunMultistart(cur_trays, pointsets[t], all_start_trays[t], array_mask);
+void MBFF::RunPointsetTask(PointsetTask& task,
+                           const Partition& partition,
+                           const float alpha,
+                           const float beta,
+                           const int ilp_workers)
+{
+  const Mask& array_mask = partition.array_mask;
+  const std::vector<Flop>& flops = task.flops;
 
-    // run capacitated k-means per tray size
-    const int num_flops = pointsets[t].size();
-    for (int i = 1; i < num_sizes_; i++) {
-      if (best_master_[array_mask][i] != nullptr) {
-        const int rows = GetRows(GetBitCnt(i), array_mask),
-                  cols = GetBitCnt(i) / rows;
-        const int num_trays = (num_flops + (GetBitCnt(i) - 1)) / GetBitCnt(i);
+  std::vector<std::vector<Tray>> cur_trays;
+  RunMultistart(cur_trays, flops, task.start_trays, array_mask);
 
-        for (int j = 0; j < num_trays; j++) {
-          GetSlots(cur_trays[i][j].pt,
-                   rows,
-                   cols,
-                   cur_trays[i][j].slots,
-                   array_mask);
-        }
+  // run capacitated k-means per tray size
+  const int num_flops = flops.size();
+  for (int i = 1; i < num_sizes_; i++) {
+    if (best_master_[array_mask][i] != nullptr) {
+      const int rows = GetRows(GetBitCnt(i), array_mask),
+                cols = GetBitCnt(i) / rows;
+      const int num_trays = (num_flops + (GetBitCnt(i) - 1)) / GetBitCnt(i);
 
-        std::vector<std::pair<int, int>> cluster;
-        RunCapacitatedKMeans(
-            pointsets[t], cur_trays[i], GetBitCnt(i), 35, cluster, array_mask);
-        MinCostFlow(pointsets[t], cur_trays[i], GetBitCnt(i), cluster);
-        for (int j = 0; j < num_trays; j++) {
-          GetSlots(cur_trays[i][j].pt,
-                   rows,
-                   cols,
-                   cur_trays[i][j].slots,
-                   array_mask);
-        }
-      }
-    }
-    for (int i = 0; i < num_sizes_; i++) {
-      if (!i || best_master_[array_mask][i] != nullptr) {
-        all_final_trays[t].insert(
-            all_final_trays[t].end(), cur_trays[i].begin(), cur_trays[i].end());
+      for (int j = 0; j < num_trays; j++) {
+        GetSlots(
+            cur_trays[i][j].pt, rows, cols, cur_trays[i][j].slots, array_mask);
       }
-    }
-    std::vector<std::pair<int, int>> mapping(num_flops);
-    const float cur_ans = RunILP(
-        pointsets[t], all_final_trays[t], mapping, alpha, beta, array_mask);
-    all_mappings[t] = std::move(mapping);
-    ans += cur_ans;
-  }
 
-  for (int t = 0; t < num_pointsets; t++) {
-    ModifyPinConnections(
-        pointsets[t], all_final_trays[t], all_mappings[t], array_mask);
-  }
-
-  if (graphics_) {
-    Graphics::LineSegs segs;
-    for (int t = 0; t < num_pointsets; t++) {
-      const int num_flops = pointsets[t].size();
-      for (int i = 0; i < num_flops; i++) {
-        const int tray_idx = all_mappings[t][i].first;
-        if (tray_idx == std::numeric_limits<int>::max()) {
-          continue;
-        }
-        const Point tray_pt = all_final_trays[t][tray_idx].pt;
-        const odb::Point tray_pt_dbu(multiplier_ * tray_pt.x,
-                                     multiplier_ * tray_pt.y);
-        const Point flop_pt = pointsets[t][i].pt;
-        const odb::Point flop_pt_dbu(multiplier_ * flop_pt.x,
-                                     multiplier_ * flop_pt.y);
-        segs.emplace_back(flop_pt_dbu, tray_pt_dbu);
+      std::vector<std::pair<int, int>> cluster;
+      RunCapacitatedKMeans(
+          flops, cur_trays[i], GetBitCnt(i), 35, cluster, array_mask);
+      MinCostFlow(flops, cur_trays[i], GetBitCnt(i), cluster);
+      for (int j = 0; j < num_trays; j++) {
+        GetSlots(
+            cur_trays[i][j].pt, rows, cols, cur_trays[i][j].slots, array_mask);
       }
     }
-
-    graphics_->mbffMapping(segs);
   }
+  for (int i = 0; i < num_sizes_; i++) {
+    if (!i || best_master_[array_mask][i] != nullptr) {
+      task.final_trays.insert(
+          task.final_trays.end(), cur_trays[i].begin(), cur_trays[i].end());
+    }
+  }
+  task.mapping.resize(num_flops);
+  task.cost = RunILP(flops,
+                     task.final_trays,
+                     task.mapping,
+                     alpha,
+                     beta,
+                     array_mask,
+                     partition.norm_power,
+                     ilp_workers,
+                     task.tray_sizes_used);
+  task.start_trays.clear();
+}
 
-  return ans;
+void MBFF::RunPointsetTasks(std::vector<PointsetTask>& tasks,
+                            const std::vector<Partition>& partitions,
+                            const float alpha,
+                            const float beta)
+{
+  // Largest pointsets first so that the small ones fill in at the end.
+  const int num_tasks = tasks.size();
+  std::vector<int> order(num_tasks);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return tasks[a].flops.size() > tasks[b].flops.size();
+  });
+
+  // Spare threads go to the CP-SAT workers of each ILP.
+  const int ilp_workers = std::max(1, num_threads_ / std::max(num_tasks, 1));
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads_)
+  for (int i = 0; i < num_tasks; i++) {
+    PointsetTask& task = tasks[order[i]];
+    RunPointsetTask(
+        task, partitions[task.partition], alpha, beta, ilp_workers);
+  }
 }
 
 void MBFF::SetVars(const std::vector<Flop>& flops)
@@ -2160,11 +2255,19 @@ void MBFF::Run(const int mx_sz, const float alpha, const float beta)
   ReadLibs();
   SetTrayNames();
 
+  using Clock = std::chrono::steady_clock;
+  auto seconds = [](Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  };
+
+  auto start = Clock::now();
   std::vector<std::vector<Flop>> FFs;
   SeparateFlops(FFs);
   const int num_chunks = FFs.size();
   float tot_ilp = 0;
   bool any_found = false;
+  std::vector<Partition> partitions;
+  std::vector<PointsetTask> tasks;
   for (int i = 0; i < num_chunks; i++) {
     dbInst* ff_inst = insts_[FFs[i].back().idx];
     const Mask array_mask = GetArrayMask(ff_inst, false);
@@ -2182,8 +2285,47 @@ void MBFF::Run(const int mx_sz, const float alpha, const float beta)
     any_found = true;
     SetVars(FFs[i]);
     SetRatios(array_mask);
-    tot_ilp += RunClustering(FFs[i], mx_sz, alpha, beta, array_mask);
+    GetPointsetTasks(FFs[i], mx_sz, array_mask, partitions.size(), tasks);
+    partitions.push_back({array_mask, norm_power_});
+  }
+  const double decomp_time = seconds(start);
+
+  start = Clock::now();
+  RunPointsetTasks(tasks, partitions, alpha, beta);
+  const double cluster_time = seconds(start);
+
+  start = Clock::now();
+  Graphics::LineSegs segs;
+  for (const PointsetTask& task : tasks) {
+    ModifyPinConnections(task.flops,
+                         task.final_trays,
+                         task.mapping,
+                         partitions[task.partition].array_mask);
+    tot_ilp += task.cost;
+    for (const auto [tray, count] : task.tray_sizes_used) {
+      tray_sizes_used_[tray] += count;
+    }
+
+    if (graphics_) {
+      for (size_t i = 0; i < task.flops.size(); i++) {
+        const int tray_idx = task.mapping[i].first;
+        if (tray_idx == std::numeric_limits<int>::max()) {
+          continue;
+        }
+        const Point tray_pt = task.final_trays[tray_idx].pt;
+        const odb::Point tray_pt_dbu(multiplier_ * tray_pt.x,
+                                     multiplier_ * tray_pt.y);
+        const Point flop_pt = task.flops[i].pt;
+        const odb::Point flop_pt_dbu(multiplier_ * flop_pt.x,
+                                     multiplier_ * flop_pt.y);
+        segs.emplace_back(flop_pt_dbu, tray_pt_dbu);
+      }
+    }
+  }
+  if (graphics_ && !tasks.empty()) {
+    graphics_->mbffMapping(segs);
   }
+  const double netlist_time = seconds(start);
 
   // delete test_trays
   for (int i = 0; i < test_idx_; i++) {
@@ -2226,6 +2368,23 @@ void MBFF::Run(const int mx_sz, const float alpha, const float beta)
   for (const auto [tray, count] : tray_sizes_used_) {
     log_->report("  {}-bit: {}", tray, count);
   }
+  debugPrint(log_,
+             GPL,
+             "mbff",
+             1,
+             "Flop partitions: {}, pointsets: {}, threads: {}",
+             partitions.size(),
+             tasks.size(),
+             num_threads_);
+  debugPrint(
+      log_,
+      GPL,
+      "mbff",
+      1,
+      "Runtime: decomposition {:.2f}s, clustering {:.2f}s, netlist {:.2f}s",
+      decomp_time,
+      cluster_time,
+      netlist_time);
 }
 
 Point MBFF::GetTrayCenter(const Mask& array_mask, const int idx)
@@ -194,12 +194,17 @@ class MBFF
   /* MODIFIED ILP for fast MBFF clustering (compliments pointset decomposition
   results) minimize sum(alpha * tray_costs + occ(i) * (slot_disp_x(i) +
   slot_disp_y(i))) where occ(i) = max(1, sum(i in launch-caputre FF-pair j)) */
+  // The solve is warm started from the capacitated K-means assignment of
+  // the cheapest tray size.
   double RunILP(const std::vector<Flop>& flops,
                 const std::vector<Tray>& trays,
                 std::vector<std::pair<int, int>>& final_flop_to_slot,
                 float alpha,
                 float beta,
-                const Mask& array_mask);
+                const Mask& array_mask,
+                const std::vector<float>& norm_power,
+                int num_workers,
+                std::map<int, int>& tray_sizes_used);
   // calculate beta (1.00) * sum(relative displacements)
   float GetPairDisplacements();
   // place trays and modify nets
@@ -212,11 +217,27 @@ class MBFF
   void SeparateFlops(std::vector<std::vector<Flop>>& ffs);
   void SetVars(const std::vector<Flop>& flops);
   void SetRatios(const Mask& array_mask);
-  float RunClustering(const std::vector<Flop>& flops,
-                      int mx_sz,
-                      float alpha,
-                      float beta,
-                      const Mask& array_mask);
+
+  // Clustering runs in three steps: the pointset decomposition and the
+  // (random) start trays of every partition are found serially, then the
+  // pointsets of all partitions are clustered in parallel and at last the
+  // trays are created in the original order.
+  struct Partition;
+  struct PointsetTask;
+  void GetPointsetTasks(const std::vector<Flop>& flops,
+                        int mx_sz,
+                        const Mask& array_mask,
+                        int partition,
+                        std::vector<PointsetTask>& tasks);
+  void RunPointsetTask(PointsetTask& task,
+                       const Partition& partition,
+                       float alpha,
+                       float beta,
+                       int ilp_workers);
+  void RunPointsetTasks(std::vector<PointsetTask>& tasks,
+                        const std::vector<Partition>& partitions,
+                        float alpha,
+                        float beta);
 
   void ReadFFs();
   void ReadPaths();
@@ -6,10 +6,12 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <random>
 #include <string>
@@ -18,6 +20,7 @@
 #include <vector>
 
 #include "fft.h"
+#include "nesterovKernels.h"
 #include "nesterovPlace.h"
 #include "odb/db.h"
 #include "placerBase.h"
@@ -50,8 +53,6 @@ static float getSecondNorm(const std::vector<FloatPoint>& a);
 // Choose to use "float" only in the following functions
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
 
-static float fastExp(float exp);
-
 ////////////////////////////////////////////////
 // GCell
 
@@ -365,21 +366,6 @@ int64_t GNet::hpwl() const
   return (ux - lx) + (uy - ly);
 }
 
-void GNet::clearWaVars()
-{
-  waExpMinSumX_ = 0;
-  waXExpMinSumX_ = 0;
-
-  waExpMaxSumX_ = 0;
-  waXExpMaxSumX_ = 0;
-
-  waExpMinSumY_ = 0;
-  waYExpMinSumY_ = 0;
-
-  waExpMaxSumY_ = 0;
-  waYExpMaxSumY_ = 0;
-}
-
 void GNet::setDontCare()
 {
   isDontCare_ = true;
@@ -399,14 +385,6 @@ void GNet::print(utl::Logger* log) const
   log->report("lx_: {}, ly_: {}, ux_: {}, uy_: {}", lx_, ly_, ux_, uy_);
   log->report("timingWeight_: {}", timingWeight_);
   log->report("customWeight_: {}", customWeight_);
-  log->report(
-      "waExpMinSumX_: {}, waXExpMinSumX_: {}", waExpMinSumX_, waXExpMinSumX_);
-  log->report(
-      "waExpMaxSumX_: {}, waXExpMaxSumX_: {}", waExpMaxSumX_, waXExpMaxSumX_);
-  log->report(
-      "waExpMinSumY_: {}, waYExpMinSumY_: {}", waExpMinSumY_, waYExpMinSumY_);
-  log->report(
-      "waExpMaxSumY_: {}, waYExpMaxSumY_: {}", waExpMaxSumY_, waYExpMaxSumY_);
   log->report("isDontCare_: {}", isDontCare_ ? "true" : "false");
 }
 
@@ -448,41 +426,6 @@ void GPin::setCenterLocation(int cx, int cy)
   cy_ = cy;
 }
 
-void GPin::clearWaVars()
-{
-  hasMaxExpSumX_ = false;
-  hasMaxExpSumY_ = false;
-  hasMinExpSumX_ = false;
-  hasMinExpSumY_ = false;
-
-  maxExpSumX_ = maxExpSumY_ = 0;
-  minExpSumX_ = minExpSumY_ = 0;
-}
-
-void GPin::setMaxExpSumX(float maxExpSumX)
-{
-  hasMaxExpSumX_ = true;
-  maxExpSumX_ = maxExpSumX;
-}
-
-void GPin::setMaxExpSumY(float maxExpSumY)
-{
-  hasMaxExpSumY_ = true;
-  maxExpSumY_ = maxExpSumY;
-}
-
-void GPin::setMinExpSumX(float minExpSumX)
-{
-  hasMinExpSumX_ = true;
-  minExpSumX_ = minExpSumX;
-}
-
-void GPin::setMinExpSumY(float minExpSumY)
-{
-  hasMinExpSumY_ = true;
-  minExpSumY_ = minExpSumY;
-}
-
 void GPin::updateLocation(const GCell* gCell)
 {
   cx_ = gCell->cx() + offsetCx_;
@@ -526,14 +469,6 @@ void GPin::print(utl::Logger* log) const
   log->report("offsetCy_: {}", offsetCy_);
   log->report("cx_: {}", cx_);
   log->report("cy_: {}", cy_);
-  log->report("maxExpSumX_: {}", maxExpSumX_);
-  log->report("maxExpSumY_: {}", maxExpSumY_);
-  log->report("minExpSumX_: {}", minExpSumX_);
-  log->report("minExpSumY_: {}", minExpSumY_);
-  log->report("hasMaxExpSumX_: {}", hasMaxExpSumX_);
-  log->report("hasMaxExpSumY_: {}", hasMaxExpSumY_);
-  log->report("hasMinExpSumX_: {}", hasMinExpSumX_);
-  log->report("hasMinExpSumY_: {}", hasMinExpSumY_);
 }
 
 ////////////////////////////////////////////////////////
@@ -832,6 +767,20 @@ void BinGrid::initBins()
 
   log_->info(GPL, 30, format_label_int, "Number of bins:", bins_.size());
 
+  binLx_.resize(binCntX_);
+  binUx_.resize(binCntX_);
+  for (int idxX = 0; idxX < binCntX_; ++idxX) {
+    binLx_[idxX] = bins_[idxX].lx();
+    binUx_[idxX] = bins_[idxX].ux();
+  }
+  binLy_.resize(binCntY_);
+  binUy_.resize(binCntY_);
+  for (int idxY = 0; idxY < binCntY_; ++idxY) {
+    binLy_[idxY] = bins_[idxY * binCntX_].ly();
+    binUy_[idxY] = bins_[idxY * binCntX_].uy();
+  }
+  overlapX_.resize(binCntX_);
+
   // only initialized once
   updateBinsNonPlaceArea();
 }
@@ -877,44 +826,49 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCellHandle>& cells)
   }
 
   for (auto& cell : cells) {
+    // macro should have
+    // scale-down with target-density
+    const bool isMacro = cell->isInstance() && cell->isMacroInstance();
+    const bool isStd = cell->isInstance() && cell->isStdInstance();
+    const bool isFiller = cell->isFiller();
+    if (!isMacro && !isStd && !isFiller) {
+      continue;
+    }
+
     std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
     std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
+    if (pairX.first >= pairX.second) {
+      continue;
+    }
 
-    // The following function is critical runtime hotspot
+    // The following loop is critical runtime hotspot
     // for global placer.
     //
-    if (cell->isInstance()) {
-      // macro should have
-      // scale-down with target-density
-      if (cell->isMacroInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-
-            const float scaledAvea = getOverlapDensityArea(bin, cell)
-                                     * cell->densityScale()
-                                     * bin.targetDensity();
-            bin.addInstPlacedAreaUnscaled(scaledAvea);
-          }
-        }
-      }
-      // normal cells
-      else if (cell->isStdInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-            const float scaledArea
-                = getOverlapDensityArea(bin, cell) * cell->densityScale();
-            bin.addInstPlacedAreaUnscaled(scaledArea);
-          }
-        }
+    // The bins form a grid so the overlap with each column is shared by
+    // every row the cell spans.
+    getOverlapLengths(cell->dLx(),
+                      cell->dUx(),
+                      &binLx_[pairX.first],
+                      &binUx_[pairX.first],
+                      pairX.second - pairX.first,
+                      &overlapX_[pairX.first]);
+
+    for (int y = pairY.first; y < pairY.second; y++) {
+      const int overlapY = std::min(binUy_[y], cell->dUy())
+                           - std::max(binLy_[y], cell->dLy());
+      if (overlapY <= 0) {
+        continue;
       }
-    } else if (cell->isFiller()) {
-      for (int y = pairY.first; y < pairY.second; y++) {
-        for (int x = pairX.first; x < pairX.second; x++) {
-          Bin& bin = bins_[y * binCntX_ + x];
-          bin.addFillerArea(getOverlapDensityArea(bin, cell)
-                            * cell->densityScale());
+      const float lengthY = static_cast<float>(overlapY);
+      for (int x = pairX.first; x < pairX.second; x++) {
+        Bin& bin = bins_[y * binCntX_ + x];
+        const float area = overlapX_[x] * lengthY * cell->densityScale();
+        if (isMacro) {
+          bin.addInstPlacedAreaUnscaled(area * bin.targetDensity());
+        } else if (isStd) {
+          bin.addInstPlacedAreaUnscaled(area);
+        } else {
+          bin.addFillerArea(area);
         }
       }
     }
@@ -1198,6 +1152,69 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
   return pbToNb(pbNet);
 }
 
+// Rebuild the CSR adjacency used by the WA kernels. The storage vectors only
+// change through the callbacks, which are always followed by fixPointers(),
+// so this only runs after such a change.
+void NesterovBaseCommon::updateWaTopology()
+{
+  const int num_pins = gPinStor_.size();
+  const int num_nets = gNetStor_.size();
+  const int num_cells = gCellStor_.size();
+  const GPin* pins = gPinStor_.data();
+
+  net_slot_start_.assign(num_nets + 1, 0);
+  slot_pin_.clear();
+  slot_net_.clear();
+  slot_pin_.reserve(num_pins);
+  slot_net_.reserve(num_pins);
+  pin_slot_.assign(num_pins, -1);
+  for (int net = 0; net < num_nets; net++) {
+    for (const GPin* gPin : gNetStor_[net].gPins()) {
+      const int pin = std::distance(pins, gPin);
+      pin_slot_[pin] = slot_pin_.size();
+      slot_pin_.push_back(pin);
+      slot_net_.push_back(net);
+    }
+    net_slot_start_[net + 1] = slot_pin_.size();
+  }
+
+  cell_slot_start_.assign(num_cells + 1, 0);
+  cell_slots_.clear();
+  cell_slots_.reserve(num_pins);
+  for (int cell = 0; cell < num_cells; cell++) {
+    for (const GPin* gPin : gCellStor_[cell].gPins()) {
+      const int slot = pin_slot_[std::distance(pins, gPin)];
+      if (slot >= 0) {
+        cell_slots_.push_back(slot);
+      }
+    }
+    cell_slot_start_[cell + 1] = cell_slots_.size();
+  }
+
+  const int num_slots = slot_pin_.size();
+  slot_cx_.resize(num_slots);
+  slot_cy_.resize(num_slots);
+  slot_min_exp_x_.resize(num_slots);
+  slot_max_exp_x_.resize(num_slots);
+  slot_min_exp_y_.resize(num_slots);
+  slot_max_exp_y_.resize(num_slots);
+
+  net_lx_.resize(num_nets);
+  net_ly_.resize(num_nets);
+  net_ux_.resize(num_nets);
+  net_uy_.resize(num_nets);
+  net_exp_min_sum_x_.resize(num_nets);
+  net_x_exp_min_sum_x_.resize(num_nets);
+  net_exp_max_sum_x_.resize(num_nets);
+  net_x_exp_max_sum_x_.resize(num_nets);
+  net_exp_min_sum_y_.resize(num_nets);
+  net_y_exp_min_sum_y_.resize(num_nets);
+  net_exp_max_sum_y_.resize(num_nets);
+  net_y_exp_max_sum_y_.resize(num_nets);
+
+  wa_topology_dirty_ = false;
+}
+
 //
 // WA force cals - wlCoeffX / wlCoeffY
 //
@@ -1206,95 +1223,107 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
   assert(omp_get_thread_num() == 0);
-  // clear all WA variables.
-#pragma omp parallel for num_threads(num_threads_)
-  for (auto gPin = gPinStor_.begin(); gPin < gPinStor_.end(); ++gPin) {
-    // old-style loop for old OpenMP
-    gPin->clearWaVars();
+  if (wa_topology_dirty_) {
+    updateWaTopology();
   }
 
+  // gather pin locations in net order.
+  const int num_slots = slot_pin_.size();
 #pragma omp parallel for num_threads(num_threads_)
-  for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
-    // old-style loop for old OpenMP
-
-    gNet->clearWaVars();
-    gNet->updateBox();
-
-    for (auto& gPin : gNet->gPins()) {
-      // The WA terms are shift invariant:
-      //
-      //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
-      //   -----------------    = -----------------
-      //   Sum(exp(x_i))          Sum(exp(x_i - C))
-      //
-      // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
-
-      // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->gCell()->name(),
-                     gPin->minExpSumX());
-        }
-      }
-
-      // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->gCell()->name(),
-                     gPin->maxExpSumX());
-        }
-      }
-
-      // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->gCell()->name(),
-                     gPin->minExpSumY());
-        }
-      }
+  for (int slot = 0; slot < num_slots; slot++) {
+    const GPin& gPin = gPinStor_[slot_pin_[slot]];
+    slot_cx_[slot] = gPin.cx();
+    slot_cy_[slot] = gPin.cy();
+  }
 
-      // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->gCell()->name(),
-                     gPin->maxExpSumY());
-        }
+  const int num_nets = gNetStor_.size();
+#pragma omp parallel for num_threads(num_threads_)
+  for (int net = 0; net < num_nets; net++) {
+    const int begin = net_slot_start_[net];
+    getPinBox(&slot_cx_[begin],
+              &slot_cy_[begin],
+              net_slot_start_[net + 1] - begin,
+              net_lx_[net],
+              net_ly_[net],
+              net_ux_[net],
+              net_uy_[net]);
+    gNetStor_[net].setBox(
+        net_lx_[net], net_ly_[net], net_ux_[net], net_uy_[net]);
+  }
+
+  // The WA terms are shift invariant:
+  //
+  //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
+  //   -----------------    = -----------------
+  //   Sum(exp(x_i))          Sum(exp(x_i - C))
+  //
+  // So we shift by the net box to keep the exponential from overflowing
+  WaExpInput in;
+  in.coeff_x = wlCoeffX;
+  in.coeff_y = wlCoeffY;
+  in.min_exp = nbVars_.minWireLengthForceBar;
+  in.net_lx = net_lx_.data();
+  in.net_ly = net_ly_.data();
+  in.net_ux = net_ux_.data();
+  in.net_uy = net_uy_.data();
+  constexpr int chunk_size = 4096;
+  const int num_chunks = (num_slots + chunk_size - 1) / chunk_size;
+#pragma omp parallel for num_threads(num_threads_) firstprivate(in)
+  for (int chunk = 0; chunk < num_chunks; chunk++) {
+    const int begin = chunk * chunk_size;
+    in.n = std::min(chunk_size, num_slots - begin);
+    in.x = &slot_cx_[begin];
+    in.y = &slot_cy_[begin];
+    in.net = &slot_net_[begin];
+    computeWaExp(in,
+                 {&slot_min_exp_x_[begin],
+                  &slot_max_exp_x_[begin],
+                  &slot_min_exp_y_[begin],
+                  &slot_max_exp_y_[begin]});
+  }
+
+  // Sum per net in pin order so the result does not depend on the threads.
+#pragma omp parallel for num_threads(num_threads_)
+  for (int net = 0; net < num_nets; net++) {
+    float expMinSumX = 0, xExpMinSumX = 0;
+    float expMaxSumX = 0, xExpMaxSumX = 0;
+    float expMinSumY = 0, yExpMinSumY = 0;
+    float expMaxSumY = 0, yExpMaxSumY = 0;
+    for (int slot = net_slot_start_[net]; slot < net_slot_start_[net + 1];
+         slot++) {
+      const int cx = slot_cx_[slot];
+      const int cy = slot_cy_[slot];
+      expMinSumX += slot_min_exp_x_[slot];
+      xExpMinSumX += cx * slot_min_exp_x_[slot];
+      expMaxSumX += slot_max_exp_x_[slot];
+      xExpMaxSumX += cx * slot_max_exp_x_[slot];
+      expMinSumY += slot_min_exp_y_[slot];
+      yExpMinSumY += cy * slot_min_exp_y_[slot];
+      expMaxSumY += slot_max_exp_y_[slot];
+      yExpMaxSumY += cy * slot_max_exp_y_[slot];
+    }
+    net_exp_min_sum_x_[net] = expMinSumX;
+    net_x_exp_min_sum_x_[net] = xExpMinSumX;
+    net_exp_max_sum_x_[net] = expMaxSumX;
+    net_x_exp_max_sum_x_[net] = xExpMaxSumX;
+    net_exp_min_sum_y_[net] = expMinSumY;
+    net_y_exp_min_sum_y_[net] = yExpMinSumY;
+    net_exp_max_sum_y_[net] = expMaxSumY;
+    net_y_exp_max_sum_y_[net] = yExpMaxSumY;
+  }
+
+  if (log_->debugCheck(GPL, "wlUpdateWA", 1)) {
+    for (int slot = 0; slot < num_slots; slot++) {
+      const GCell* gCell = gPinStor_[slot_pin_[slot]].gCell();
+      if (gCell && gCell->isInstance()) {
+        log_->debug(GPL,
+                    "wlUpdateWA",
+                    "{} X[{:g} {:g}] Y[{:g} {:g}]",
+                    gCell->name(),
+                    slot_min_exp_x_[slot],
+                    slot_max_exp_x_[slot],
+                    slot_min_exp_y_[slot],
+                    slot_max_exp_y_[slot]);
       }
     }
   }
@@ -1307,8 +1336,16 @@ FloatPoint NesterovBaseCommon::getWireLengthGradientWA(const GCell* gCell,
 {
   FloatPoint gradientPair;
 
-  for (auto& gPin : gCell->gPins()) {
-    auto tmpPair = getWireLengthGradientPinWA(gPin, wlCoeffX, wlCoeffY);
+  // Fillers have no pins and the WA terms are stale until the next
+  // updateWireLengthForceWA() after the storage changed.
+  if (gCell->gPins().empty() || wa_topology_dirty_) {
+    return gradientPair;
+  }
+
+  const size_t cell = getGCellIndex(gCell);
+  for (int k = cell_slot_start_[cell]; k < cell_slot_start_[cell + 1]; k++) {
+    const int slot = cell_slots_[k];
+    auto tmpPair = getWireLengthGradientSlotWA(slot, wlCoeffX, wlCoeffY);
 
     debugPrint(log_,
                GPL,
@@ -1319,8 +1356,9 @@ FloatPoint NesterovBaseCommon::getWireLengthGradientWA(const GCell* gCell,
                tmpPair.y);
 
     // apply timing/custom net weight
-    tmpPair.x *= gPin->gNet()->totalWeight();
-    tmpPair.y *= gPin->gNet()->totalWeight();
+    const float weight = gNetStor_[slot_net_[slot]].totalWeight();
+    tmpPair.x *= weight;
+    tmpPair.y *= weight;
 
     gradientPair.x += tmpPair.x;
     gradientPair.y += tmpPair.y;
@@ -1341,62 +1379,80 @@ FloatPoint NesterovBaseCommon::getWireLengthGradientWA(const GCell* gCell,
   return gradientPair;
 }
 
-// get x,y WA Gradient values from GPin
+FloatPoint NesterovBaseCommon::getWireLengthGradientPinWA(const GPin* gPin,
+                                                          float wlCoeffX,
+                                                          float wlCoeffY) const
+{
+  if (wa_topology_dirty_) {
+    return FloatPoint();
+  }
+  const int slot = pin_slot_[std::distance(gPinStor_.data(), gPin)];
+  if (slot < 0) {
+    return FloatPoint();
+  }
+  return getWireLengthGradientSlotWA(slot, wlCoeffX, wlCoeffY);
+}
+
+// get x,y WA Gradient values from a pin slot
 // Please check the JingWei's Ph.D. thesis full paper,
 // Equation (4.13)
 //
 // You can't understand the following function
 // unless you read the (4.13) formula
-FloatPoint NesterovBaseCommon::getWireLengthGradientPinWA(const GPin* gPin,
-                                                          float wlCoeffX,
-                                                          float wlCoeffY) const
+FloatPoint NesterovBaseCommon::getWireLengthGradientSlotWA(int slot,
+                                                           float wlCoeffX,
+                                                           float wlCoeffY) const
 {
   float gradientMinX = 0, gradientMinY = 0;
   float gradientMaxX = 0, gradientMaxY = 0;
 
+  const int net = slot_net_[slot];
+  const int cx = slot_cx_[slot];
+  const int cy = slot_cy_[slot];
+
   // min x
-  if (gPin->hasMinExpSumX()) {
+  const float minExpSumX = slot_min_exp_x_[slot];
+  if (minExpSumX != 0) {
     // from Net.
-    float waExpMinSumX = gPin->gNet()->waExpMinSumX();
-    float waXExpMinSumX = gPin->gNet()->waXExpMinSumX();
+    float waExpMinSumX = net_exp_min_sum_x_[net];
+    float waXExpMinSumX = net_x_exp_min_sum_x_[net];
 
-    gradientMinX
-        = (waExpMinSumX * (gPin->minExpSumX() * (1.0 - wlCoeffX * gPin->cx()))
-           + wlCoeffX * gPin->minExpSumX() * waXExpMinSumX)
-          / (waExpMinSumX * waExpMinSumX);
+    gradientMinX = (waExpMinSumX * (minExpSumX * (1.0 - wlCoeffX * cx))
+                    + wlCoeffX * minExpSumX * waXExpMinSumX)
+                   / (waExpMinSumX * waExpMinSumX);
   }
 
   // max x
-  if (gPin->hasMaxExpSumX()) {
-    float waExpMaxSumX = gPin->gNet()->waExpMaxSumX();
-    float waXExpMaxSumX = gPin->gNet()->waXExpMaxSumX();
+  const float maxExpSumX = slot_max_exp_x_[slot];
+  if (maxExpSumX != 0) {
+    float waExpMaxSumX = net_exp_max_sum_x_[net];
+    float waXExpMaxSumX = net_x_exp_max_sum_x_[net];
 
-    gradientMaxX
-        = (waExpMaxSumX * (gPin->maxExpSumX() * (1.0 + wlCoeffX * gPin->cx()))
-           - wlCoeffX * gPin->maxExpSumX() * waXExpMaxSumX)
-          / (waExpMaxSumX * waExpMaxSumX);
+    gradientMaxX = (waExpMaxSumX * (maxExpSumX * (1.0 + wlCoeffX * cx))
+                    - wlCoeffX * maxExpSumX * waXExpMaxSumX)
+                   / (waExpMaxSumX * waExpMaxSumX);
   }
 
   // min y
-  if (gPin->hasMinExpSumY()) {
-    float waExpMinSumY = gPin->gNet()->waExpMinSumY();
-    float waYExpMinSumY = gPin->gNet()->waYExpMinSumY();
+  const float minExpSumY = slot_min_exp_y_[slot];
+  if (minExpSumY != 0) {
+    float waExpMinSumY = net_exp_min_sum_y_[net];
+    float waYExpMinSumY = net_y_exp_min_sum_y_[net];
 
-    gradientMinY
-        = (waExpMinSumY * (gPin->minExpSumY() * (1.0 - wlCoeffY * gPin->cy()))
-           + wlCoeffY * gPin->minExpSumY() * waYExpMinSumY)
-          / (waExpMinSumY * waExpMinSumY);
+    gradientMinY = (waExpMinSumY * (minExpSumY * (1.0 - wlCoeffY * cy))
+                    + wlCoeffY * minExpSumY * waYExpMinSumY)
+                   / (waExpMinSumY * waExpMinSumY);
   }
 
   // max y
-  if (gPin->hasMaxExpSumY()) {
-    float waExpMaxSumY = gPin->gNet()->waExpMaxSumY();
-    float waYExpMaxSumY = gPin->gNet()->waYExpMaxSumY();
+  const float maxExpSumY = slot_max_exp_y_[slot];
+  if (maxExpSumY != 0) {
+    float waExpMaxSumY = net_exp_max_sum_y_[net];
+    float waYExpMaxSumY = net_y_exp_max_sum_y_[net];
 
-    gradientMaxY
-        = (waExpMaxSumY * (gPin->maxExpSumY() * (1.0 + wlCoeffY * gPin->cy()))
-           - wlCoeffY * gPin->maxExpSumY() * waYExpMaxSumY)
-          / (waExpMaxSumY * waExpMaxSumY);
+    gradientMaxY = (waExpMaxSumY * (maxExpSumY * (1.0 + wlCoeffY * cy))
+                    - wlCoeffY * maxExpSumY * waYExpMaxSumY)
+                   / (waExpMaxSumY * waExpMaxSumY);
   }
 
   debugPrint(log_,
@@ -1509,6 +1565,7 @@ GCell* NesterovBaseCommon::getGCellByIndex(size_t i)
 //
 void NesterovBaseCommon::fixPointers()
 {
+  wa_topology_dirty_ = true;
   nbc_gcells_.clear();
   gCellMap_.clear();
   db_inst_to_nbc_index_map_.clear();
@@ -1711,8 +1768,11 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   bg_.initBins();
 
   // initialize fft structrue based on bins
-  std::unique_ptr<FFT> fft(
-      new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  std::unique_ptr<FFT> fft(new FFT(bg_.binCntX(),
+                                   bg_.binCntY(),
+                                   bg_.binSizeX(),
+                                   bg_.binSizeY(),
+                                   nbc_->getNumThreads()));
 
   fft_ = std::move(fft);
 
@@ -2618,7 +2678,7 @@ void NesterovBase::updateNextIter(const int iter)
     }
 
     if ((iter == 0 || reprint_iter_header) && !pb_->group()) {
-      if (iter == 0) {
+      if (iter == 0 && !npVars_->sweepRun) {
         log_->info(GPL, 31, "HPWL: Half-Perimeter Wirelength");
       }
 
@@ -2631,20 +2691,21 @@ void NesterovBase::updateNextIter(const int iter)
                         "Penalty",
                         "Group");
 
-      log_->report(nesterov_header);
-      log_->report(
+      reportIter(nesterov_header);
+      reportIter(
           "---------------------------------------------------------------");
 
       reprint_iter_header = false;
     }
 
-    log_->report("{:9d} | {:8.4f} | {:13.6e} | {:+7.2f}% | {:9.2e} | {:>5}",
-                 iter + 1,
-                 sumOverflowUnscaled_,
-                 static_cast<double>(hpwl),
-                 percentageChange,
-                 densityPenalty_,
-                 group);
+    reportIter(
+        fmt::format("{:9d} | {:8.4f} | {:13.6e} | {:+7.2f}% | {:9.2e} | {:>5}",
+                    iter + 1,
+                    sumOverflowUnscaled_,
+                    static_cast<double>(hpwl),
+                    percentageChange,
+                    densityPenalty_,
+                    group));
   }
 
   debugPrint(log_, GPL, "updateNextIter", 1, "PreviousHPWL: {}", prevHpwl_);
@@ -2759,12 +2820,28 @@ void NesterovBase::snapshot()
   snapshotStepLength_ = stepLength_;
 }
 
+void NesterovBase::reportIter(const std::string& line)
+{
+  if (npVars_->sweepRun) {
+    sweepReport_ += line;
+    sweepReport_ += '\n';
+  } else {
+    log_->report("{}", line);
+  }
+}
+
 bool NesterovBase::checkConvergence()
 {
   assert(omp_get_thread_num() == 0);
   if (isConverged_) {
     return true;
   }
+  // The sweep summarizes the final overflow of every run itself and
+  // leaves the shared instances unlocked.
+  if (sumOverflowUnscaled_ <= npVars_->targetOverflow && npVars_->sweepRun) {
+    isConverged_ = true;
+    return true;
+  }
   if (sumOverflowUnscaled_ <= npVars_->targetOverflow) {
     if (pb_->group()) {
       log_->info(GPL,
@@ -3515,23 +3592,6 @@ static float calculateBiVariateNormalCDF(biNormalParameters i)
          * (std::erf(x1) * std::erf(y1) + std::erf(x2) * std::erf(y2)
             - std::erf(x1) * std::erf(y2) - std::erf(x2) * std::erf(y1));
 }
-//
-// https://codingforspeed.com/using-faster-exponential-approximation/
-static float fastExp(float exp)
-{
-  exp = 1.0f + exp / 1024.0f;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  exp *= exp;
-  return exp;
-}
 
 static float getDistance(const std::vector<FloatPoint>& a,
                          const std::vector<FloatPoint>& b)
@@ -235,38 +235,12 @@ class GNet
   void addGPin(GPin* gPin);
   void clearGPins() { gPins_.clear(); }
   void updateBox();
+  void setBox(int lx, int ly, int ux, int uy);
   int64_t hpwl() const;
 
   void setDontCare();
   bool isDontCare() const;
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
-
-  void addWaExpMinSumX(float waExpMinSumX);
-  void addWaXExpMinSumX(float waXExpMinSumX);
-
-  void addWaExpMinSumY(float waExpMinSumY);
-  void addWaYExpMinSumY(float waYExpMinSumY);
-
-  void addWaExpMaxSumX(float waExpMaxSumX);
-  void addWaXExpMaxSumX(float waXExpMaxSumX);
-
-  void addWaExpMaxSumY(float waExpMaxSumY);
-  void addWaYExpMaxSumY(float waYExpMaxSumY);
-
-  float waExpMinSumX() const;
-  float waXExpMinSumX() const;
-
-  float waExpMinSumY() const;
-  float waYExpMinSumY() const;
-
-  float waExpMaxSumX() const;
-  float waXExpMaxSumX() const;
-
-  float waExpMaxSumY() const;
-  float waYExpMaxSumY() const;
-
   void print(utl::Logger* log) const;
 
  private:
@@ -280,43 +254,6 @@ class GNet
   float timingWeight_ = 1;
   float customWeight_ = 1;
 
-  //
-  // weighted average WL model stor for better indexing
-  // Please check the equation (4) in the ePlace-MS paper.
-  //
-  // WA: weighted Average
-  // saving four variable will be helpful for
-  // calculating the WA gradients/wirelengths.
-  //
-  // gamma: modeling accuracy.
-  //
-  // X forces.
-  //
-  // waExpMinSumX_: store sigma {exp(x_i/gamma)}
-  // waXExpMinSumX_: store signa {x_i*exp(e_i/gamma)}
-  // waExpMaxSumX_ : store sigma {exp(-x_i/gamma)}
-  // waXExpMaxSumX_: store sigma {x_i*exp(-x_i/gamma)}
-  //
-  float waExpMinSumX_ = 0;
-  float waXExpMinSumX_ = 0;
-
-  float waExpMaxSumX_ = 0;
-  float waXExpMaxSumX_ = 0;
-
-  //
-  // Y forces.
-  //
-  // waExpMinSumY_: store sigma {exp(y_i/gamma)}
-  // waYExpMinSumY_: store signa {y_i*exp(e_i/gamma)}
-  // waExpMaxSumY_ : store sigma {exp(-y_i/gamma)}
-  // waYExpMaxSumY_: store sigma {y_i*exp(-y_i/gamma)}
-  //
-  float waExpMinSumY_ = 0;
-  float waYExpMinSumY_ = 0;
-
-  float waExpMaxSumY_ = 0;
-  float waYExpMaxSumY_ = 0;
-
   bool isDontCare_ = false;
 };
 
@@ -340,85 +277,12 @@ inline int GNet::uy() const
   return uy_;
 }
 
-// eight add functions
-inline void GNet::addWaExpMinSumX(float waExpMinSumX)
-{
-  waExpMinSumX_ += waExpMinSumX;
-}
-
-inline void GNet::addWaXExpMinSumX(float waXExpMinSumX)
-{
-  waXExpMinSumX_ += waXExpMinSumX;
-}
-
-inline void GNet::addWaExpMinSumY(float waExpMinSumY)
-{
-  waExpMinSumY_ += waExpMinSumY;
-}
-
-inline void GNet::addWaYExpMinSumY(float waYExpMinSumY)
-{
-  waYExpMinSumY_ += waYExpMinSumY;
-}
-
-inline void GNet::addWaExpMaxSumX(float waExpMaxSumX)
-{
-  waExpMaxSumX_ += waExpMaxSumX;
-}
-
-inline void GNet::addWaXExpMaxSumX(float waXExpMaxSumX)
-{
-  waXExpMaxSumX_ += waXExpMaxSumX;
-}
-
-inline void GNet::addWaExpMaxSumY(float waExpMaxSumY)
+inline void GNet::setBox(int lx, int ly, int ux, int uy)
 {
-  waExpMaxSumY_ += waExpMaxSumY;
-}
-
-inline void GNet::addWaYExpMaxSumY(float waYExpMaxSumY)
-{
-  waYExpMaxSumY_ += waYExpMaxSumY;
-}
-
-inline float GNet::waExpMinSumX() const
-{
-  return waExpMinSumX_;
-}
-
-inline float GNet::waXExpMinSumX() const
-{
-  return waXExpMinSumX_;
-}
-
-inline float GNet::waExpMinSumY() const
-{
-  return waExpMinSumY_;
-}
-
-inline float GNet::waYExpMinSumY() const
-{
-  return waYExpMinSumY_;
-}
-
-inline float GNet::waExpMaxSumX() const
-{
-  return waExpMaxSumX_;
-}
-
-inline float GNet::waXExpMaxSumX() const
-{
-  return waXExpMaxSumX_;
-}
-
-inline float GNet::waExpMaxSumY() const
-{
-  return waExpMaxSumY_;
-}
-
-inline float GNet::waYExpMaxSumY() const
-{
-  return waYExpMaxSumY_;
+  lx_ = lx;
+  ly_ = ly;
+  ux_ = ux;
+  uy_ = uy;
 }
 
 class GPin
@@ -439,24 +303,6 @@ class GPin
   int cx() const { return cx_; }
   int cy() const { return cy_; }
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
-
-  void setMaxExpSumX(float maxExpSumX);
-  void setMaxExpSumY(float maxExpSumY);
-  void setMinExpSumX(float minExpSumX);
-  void setMinExpSumY(float minExpSumY);
-
-  float maxExpSumX() const { return maxExpSumX_; }
-  float maxExpSumY() const { return maxExpSumY_; }
-  float minExpSumX() const { return minExpSumX_; }
-  float minExpSumY() const { return minExpSumY_; }
-
-  bool hasMaxExpSumX() const { return hasMaxExpSumX_; }
-  bool hasMaxExpSumY() const { return hasMaxExpSumY_; }
-  bool hasMinExpSumX() const { return hasMinExpSumX_; }
-  bool hasMinExpSumY() const { return hasMinExpSumY_; }
-
   void setCenterLocation(int cx, int cy);
   void updateLocation(const GCell* gCell);
   void updateDensityLocation(const GCell* gCell);
@@ -473,29 +319,6 @@ class GPin
   int offsetCy_ = 0;
   int cx_ = 0;
   int cy_ = 0;
-
-  // weighted average WL vals stor for better indexing
-  // Please check the equation (4) in the ePlace-MS paper.
-  //
-  // maxExpSum_: holds exp(x_i/gamma)
-  // minExpSum_: holds exp(-x_i/gamma)
-  // the x_i is equal to cx_ variable.
-  //
-  float maxExpSumX_ = 0;
-  float maxExpSumY_ = 0;
-
-  float minExpSumX_ = 0;
-  float minExpSumY_ = 0;
-
-  // flag variables
-  //
-  // check whether
-  // this pin is considered in a WA models.
-  bool hasMaxExpSumX_ = false;
-  bool hasMaxExpSumY_ = false;
-
-  bool hasMinExpSumX_ = false;
-  bool hasMinExpSumY_ = false;
 };
 
 class Bin
@@ -711,6 +534,14 @@ class BinGrid
   int64_t sumOverflowAreaUnscaled_ = 0;
   bool isSetBinCnt_ = false;
   int num_threads_ = 1;
+
+  // Bounds of each bin column / row and the overlap of a cell with the
+  // columns it spans, for updateBinsGCellDensityArea.
+  std::vector<int> binLx_;
+  std::vector<int> binUx_;
+  std::vector<int> binLy_;
+  std::vector<int> binUy_;
+  std::vector<float> overlapX_;
 };
 
 inline std::vector<Bin>& BinGrid::bins()
@@ -755,6 +586,10 @@ class NesterovPlaceVars
   int timingDrivenIterCounter = 0;
   bool routability_driven_mode = true;
   bool disableRevertIfDiverge = false;
+  // One of several concurrent runs sharing the PlacerBase (see
+  // Replace::doNesterovPlaceSweep): the db and the shared instances are
+  // left untouched.
+  bool sweepRun = false;
 
   bool debug = false;
   int debug_pause_iterations = 10;
@@ -897,6 +732,51 @@ class NesterovBaseCommon
   int64_t delta_area_;
   int new_gcells_count_;
   nesterovDbCbk* db_cbk_{nullptr};
+
+  // Rebuild the adjacency below after the storage vectors changed.
+  void updateWaTopology();
+  FloatPoint getWireLengthGradientSlotWA(int slot,
+                                         float wlCoeffX,
+                                         float wlCoeffY) const;
+
+  // Structure-of-arrays view of the pins and nets used by the WA kernels so
+  // they stream over contiguous arrays instead of chasing GNet/GPin
+  // pointers. Each pin on a net has a slot; slots are ordered by net
+  // (indexed as gNetStor_) and net_slot_start_ holds the CSR offsets.
+  // cell_slots_ lists the slots of each cell (indexed as gCellStor_) with
+  // offsets in cell_slot_start_.
+  bool wa_topology_dirty_ = true;
+  std::vector<int> net_slot_start_;
+  std::vector<int> cell_slot_start_;
+  std::vector<int> cell_slots_;
+  std::vector<int> pin_slot_;
+  std::vector<int> slot_pin_;
+  std::vector<int> slot_net_;
+  std::vector<int> slot_cx_;
+  std::vector<int> slot_cy_;
+
+  std::vector<int> net_lx_;
+  std::vector<int> net_ly_;
+  std::vector<int> net_ux_;
+  std::vector<int> net_uy_;
+
+  // Per slot exp(x_i/gamma) terms of the WA model, zero for a pin that is
+  // not considered. Please check the equation (4) in the ePlace-MS paper.
+  std::vector<float> slot_min_exp_x_;
+  std::vector<float> slot_max_exp_x_;
+  std::vector<float> slot_min_exp_y_;
+  std::vector<float> slot_max_exp_y_;
+
+  // Per net sums of the above, sigma {exp(x_i/gamma)} and
+  // sigma {x_i * exp(x_i/gamma)}.
+  std::vector<float> net_exp_min_sum_x_;
+  std::vector<float> net_x_exp_min_sum_x_;
+  std::vector<float> net_exp_max_sum_x_;
+  std::vector<float> net_x_exp_max_sum_x_;
+  std::vector<float> net_exp_min_sum_y_;
+  std::vector<float> net_y_exp_min_sum_y_;
+  std::vector<float> net_exp_max_sum_y_;
+  std::vector<float> net_y_exp_max_sum_y_;
 };
 
 // Stores instances belonging to a specific power domain
@@ -920,6 +800,7 @@ class NesterovBase
   float getSumOverflowUnscaled() const { return sumOverflowUnscaled_; }
   float getBaseWireLengthCoef() const { return baseWireLengthCoef_; }
   float getDensityPenalty() const { return densityPenalty_; }
+  float getTargetDensity() const { return targetDensity_; }
 
   float getWireLengthGradSum() const { return wireLengthGradSum_; }
   float getDensityGradSum() const { return densityGradSum_; }
@@ -1047,6 +928,9 @@ class NesterovBase
 
   void updateNextIter(int iter);
   void setTrueReprintIterHeader() { reprint_iter_header = true; }
+  // Iteration lines of a sweep run, kept here instead of being logged so
+  // that concurrent runs do not interleave.
+  const std::string& getSweepReport() const { return sweepReport_; }
   float getPhiCoef(float scaledDiffHpwl) const;
 
   void snapshot();
@@ -1182,7 +1066,9 @@ class NesterovBase
   int iter_ = 0;
   bool isConverged_ = false;
   bool reprint_iter_header;
+  std::string sweepReport_;
 
+  void reportIter(const std::string& line);
   void initFillerGCells();
 };
 
@@ -0,0 +1,446 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#include "nesterovKernels.h"
+
+#include <algorithm>
+#include <climits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GPL_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace gpl {
+
+////////////////////////////////////////////////
+// Scalar
+
+static void getPinBoxScalar(const int* x,
+                            const int* y,
+                            int n,
+                            int& lx,
+                            int& ly,
+                            int& ux,
+                            int& uy)
+{
+  lx = ly = INT_MAX;
+  ux = uy = INT_MIN;
+  for (int i = 0; i < n; i++) {
+    lx = std::min(x[i], lx);
+    ly = std::min(y[i], ly);
+    ux = std::max(x[i], ux);
+    uy = std::max(y[i], uy);
+  }
+}
+
+static void computeWaExpScalar(const WaExpInput& in,
+                               const WaExpOutput& out,
+                               int begin)
+{
+  for (int i = begin; i < in.n; i++) {
+    const int net = in.net[i];
+    const float exp_min_x = (in.net_lx[net] - in.x[i]) * in.coeff_x;
+    const float exp_max_x = (in.x[i] - in.net_ux[net]) * in.coeff_x;
+    const float exp_min_y = (in.net_ly[net] - in.y[i]) * in.coeff_y;
+    const float exp_max_y = (in.y[i] - in.net_uy[net]) * in.coeff_y;
+    out.min_x[i] = exp_min_x > in.min_exp ? fastExp(exp_min_x) : 0;
+    out.max_x[i] = exp_max_x > in.min_exp ? fastExp(exp_max_x) : 0;
+    out.min_y[i] = exp_min_y > in.min_exp ? fastExp(exp_min_y) : 0;
+    out.max_y[i] = exp_max_y > in.min_exp ? fastExp(exp_max_y) : 0;
+  }
+}
+
+static void computeWaExpScalar(const WaExpInput& in, const WaExpOutput& out)
+{
+  computeWaExpScalar(in, out, 0);
+}
+
+static void getOverlapLengthsScalar(int lo,
+                                    int hi,
+                                    const int* bin_lo,
+                                    const int* bin_hi,
+                                    int n,
+                                    float* length,
+                                    int begin)
+{
+  for (int i = begin; i < n; i++) {
+    const int overlap = std::min(hi, bin_hi[i]) - std::max(lo, bin_lo[i]);
+    length[i] = overlap > 0 ? static_cast<float>(overlap) : 0;
+  }
+}
+
+static void getOverlapLengthsScalar(int lo,
+                                    int hi,
+                                    const int* bin_lo,
+                                    const int* bin_hi,
+                                    int n,
+                                    float* length)
+{
+  getOverlapLengthsScalar(lo, hi, bin_lo, bin_hi, n, length, 0);
+}
+
+#ifdef GPL_X86_SIMD
+
+// The vector versions only use the operations of the scalar code in the
+// same order (x / 1024 is exact, as is x * (1 / 1024)), so they round
+// identically and the placement stays the same whatever the host.
+
+////////////////////////////////////////////////
+// AVX2
+
+__attribute__((target("avx2"))) static __m256 fastExpAvx2(__m256 exp)
+{
+  exp = _mm256_add_ps(_mm256_set1_ps(1.0f),
+                      _mm256_mul_ps(exp, _mm256_set1_ps(1.0f / 1024.0f)));
+  for (int i = 0; i < 10; i++) {
+    exp = _mm256_mul_ps(exp, exp);
+  }
+  return exp;
+}
+
+__attribute__((target("avx2"))) static void getPinBoxAvx2(const int* x,
+                                                          const int* y,
+                                                          int n,
+                                                          int& lx,
+                                                          int& ly,
+                                                          int& ux,
+                                                          int& uy)
+{
+  constexpr int width = 8;
+  if (n < width) {
+    // Most nets are small.
+    getPinBoxScalar(x, y, n, lx, ly, ux, uy);
+    return;
+  }
+  __m256i min_x = _mm256_set1_epi32(INT_MAX);
+  __m256i min_y = _mm256_set1_epi32(INT_MAX);
+  __m256i max_x = _mm256_set1_epi32(INT_MIN);
+  __m256i max_y = _mm256_set1_epi32(INT_MIN);
+  int i = 0;
+  for (; i + width <= n; i += width) {
+    const __m256i vx
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+    const __m256i vy
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+    min_x = _mm256_min_epi32(min_x, vx);
+    min_y = _mm256_min_epi32(min_y, vy);
+    max_x = _mm256_max_epi32(max_x, vx);
+    max_y = _mm256_max_epi32(max_y, vy);
+  }
+
+  alignas(32) int lanes[4][width];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), min_x);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), min_y);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), max_x);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), max_y);
+  getPinBoxScalar(x + i, y + i, n - i, lx, ly, ux, uy);
+  for (int lane = 0; lane < width; lane++) {
+    lx = std::min(lanes[0][lane], lx);
+    ly = std::min(lanes[1][lane], ly);
+    ux = std::max(lanes[2][lane], ux);
+    uy = std::max(lanes[3][lane], uy);
+  }
+}
+
+__attribute__((target("avx2"))) static __m256 waExpAvx2(__m256i diff,
+                                                        __m256 coeff,
+                                                        __m256 min_exp)
+{
+  const __m256 exp = _mm256_mul_ps(_mm256_cvtepi32_ps(diff), coeff);
+  const __m256 keep = _mm256_cmp_ps(exp, min_exp, _CMP_GT_OQ);
+  return _mm256_and_ps(keep, fastExpAvx2(exp));
+}
+
+__attribute__((target("avx2"))) static void computeWaExpAvx2(
+    const WaExpInput& in,
+    const WaExpOutput& out)
+{
+  constexpr int width = 8;
+  const __m256 coeff_x = _mm256_set1_ps(in.coeff_x);
+  const __m256 coeff_y = _mm256_set1_ps(in.coeff_y);
+  const __m256 min_exp = _mm256_set1_ps(in.min_exp);
+  int i = 0;
+  for (; i + width <= in.n; i += width) {
+    const __m256i net
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in.net + i));
+    const __m256i x
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in.x + i));
+    const __m256i y
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in.y + i));
+    const __m256i lx = _mm256_i32gather_epi32(in.net_lx, net, 4);
+    const __m256i ly = _mm256_i32gather_epi32(in.net_ly, net, 4);
+    const __m256i ux = _mm256_i32gather_epi32(in.net_ux, net, 4);
+    const __m256i uy = _mm256_i32gather_epi32(in.net_uy, net, 4);
+    _mm256_storeu_ps(out.min_x + i,
+                     waExpAvx2(_mm256_sub_epi32(lx, x), coeff_x, min_exp));
+    _mm256_storeu_ps(out.max_x + i,
+                     waExpAvx2(_mm256_sub_epi32(x, ux), coeff_x, min_exp));
+    _mm256_storeu_ps(out.min_y + i,
+                     waExpAvx2(_mm256_sub_epi32(ly, y), coeff_y, min_exp));
+    _mm256_storeu_ps(out.max_y + i,
+                     waExpAvx2(_mm256_sub_epi32(y, uy), coeff_y, min_exp));
+  }
+  computeWaExpScalar(in, out, i);
+}
+
+__attribute__((target("avx2"))) static void getOverlapLengthsAvx2(
+    int lo,
+    int hi,
+    const int* bin_lo,
+    const int* bin_hi,
+    int n,
+    float* length)
+{
+  constexpr int width = 8;
+  const __m256i vlo = _mm256_set1_epi32(lo);
+  const __m256i vhi = _mm256_set1_epi32(hi);
+  const __m256i zero = _mm256_setzero_si256();
+  int i = 0;
+  for (; i + width <= n; i += width) {
+    const __m256i blo
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bin_lo + i));
+    const __m256i bhi
+        = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bin_hi + i));
+    const __m256i overlap = _mm256_sub_epi32(_mm256_min_epi32(vhi, bhi),
+                                             _mm256_max_epi32(vlo, blo));
+    _mm256_storeu_ps(length + i,
+                     _mm256_cvtepi32_ps(_mm256_max_epi32(overlap, zero)));
+  }
+  getOverlapLengthsScalar(lo, hi, bin_lo, bin_hi, n, length, i);
+}
+
+////////////////////////////////////////////////
+// AVX-512
+
+// The GCC 12 headers seed several intrinsics with _mm512_undefined_*(),
+// which trips -Wuninitialized once they are inlined here.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512f"))) static __m512 fastExpAvx512(__m512 exp)
+{
+  exp = _mm512_add_ps(_mm512_set1_ps(1.0f),
+                      _mm512_mul_ps(exp, _mm512_set1_ps(1.0f / 1024.0f)));
+  for (int i = 0; i < 10; i++) {
+    exp = _mm512_mul_ps(exp, exp);
+  }
+  return exp;
+}
+
+__attribute__((target("avx512f"))) static void getPinBoxAvx512(const int* x,
+                                                               const int* y,
+                                                               int n,
+                                                               int& lx,
+                                                               int& ly,
+                                                               int& ux,
+                                                               int& uy)
+{
+  constexpr int width = 16;
+  if (n < width) {
+    // Most nets are small.
+    getPinBoxScalar(x, y, n, lx, ly, ux, uy);
+    return;
+  }
+  __m512i min_x = _mm512_set1_epi32(INT_MAX);
+  __m512i min_y = _mm512_set1_epi32(INT_MAX);
+  __m512i max_x = _mm512_set1_epi32(INT_MIN);
+  __m512i max_y = _mm512_set1_epi32(INT_MIN);
+  int i = 0;
+  for (; i + width <= n; i += width) {
+    const __m512i vx = _mm512_loadu_si512(x + i);
+    const __m512i vy = _mm512_loadu_si512(y + i);
+    min_x = _mm512_min_epi32(min_x, vx);
+    min_y = _mm512_min_epi32(min_y, vy);
+    max_x = _mm512_max_epi32(max_x, vx);
+    max_y = _mm512_max_epi32(max_y, vy);
+  }
+
+  alignas(64) int lanes[4][width];
+  _mm512_store_si512(lanes[0], min_x);
+  _mm512_store_si512(lanes[1], min_y);
+  _mm512_store_si512(lanes[2], max_x);
+  _mm512_store_si512(lanes[3], max_y);
+  getPinBoxScalar(x + i, y + i, n - i, lx, ly, ux, uy);
+  for (int lane = 0; lane < width; lane++) {
+    lx = std::min(lanes[0][lane], lx);
+    ly = std::min(lanes[1][lane], ly);
+    ux = std::max(lanes[2][lane], ux);
+    uy = std::max(lanes[3][lane], uy);
+  }
+}
+
+__attribute__((target("avx512f"))) static __m512 waExpAvx512(__m512i diff,
+                                                             __m512 coeff,
+                                                             __m512 min_exp)
+{
+  const __m512 exp = _mm512_mul_ps(_mm512_cvtepi32_ps(diff), coeff);
+  const __mmask16 keep = _mm512_cmp_ps_mask(exp, min_exp, _CMP_GT_OQ);
+  return _mm512_maskz_mov_ps(keep, fastExpAvx512(exp));
+}
+
+__attribute__((target("avx512f"))) static void computeWaExpAvx512(
+    const WaExpInput& in,
+    const WaExpOutput& out)
+{
+  constexpr int width = 16;
+  const __m512 coeff_x = _mm512_set1_ps(in.coeff_x);
+  const __m512 coeff_y = _mm512_set1_ps(in.coeff_y);
+  const __m512 min_exp = _mm512_set1_ps(in.min_exp);
+  int i = 0;
+  for (; i + width <= in.n; i += width) {
+    const __m512i net = _mm512_loadu_si512(in.net + i);
+    const __m512i x = _mm512_loadu_si512(in.x + i);
+    const __m512i y = _mm512_loadu_si512(in.y + i);
+    const __m512i lx = _mm512_i32gather_epi32(net, in.net_lx, 4);
+    const __m512i ly = _mm512_i32gather_epi32(net, in.net_ly, 4);
+    const __m512i ux = _mm512_i32gather_epi32(net, in.net_ux, 4);
+    const __m512i uy = _mm512_i32gather_epi32(net, in.net_uy, 4);
+    _mm512_storeu_ps(out.min_x + i,
+                     waExpAvx512(_mm512_sub_epi32(lx, x), coeff_x, min_exp));
+    _mm512_storeu_ps(out.max_x + i,
+                     waExpAvx512(_mm512_sub_epi32(x, ux), coeff_x, min_exp));
+    _mm512_storeu_ps(out.min_y + i,
+                     waExpAvx512(_mm512_sub_epi32(ly, y), coeff_y, min_exp));
+    _mm512_storeu_ps(out.max_y + i,
+                     waExpAvx512(_mm512_sub_epi32(y, uy), coeff_y, min_exp));
+  }
+  computeWaExpScalar(in, out, i);
+}
+
+__attribute__((target("avx512f"))) static void getOverlapLengthsAvx512(
+    int lo,
+    int hi,
+    const int* bin_lo,
+    const int* bin_hi,
+    int n,
+    float* length)
+{
+  constexpr int width = 16;
+  const __m512i vlo = _mm512_set1_epi32(lo);
+  const __m512i vhi = _mm512_set1_epi32(hi);
+  const __m512i zero = _mm512_setzero_si512();
+  int i = 0;
+  for (; i + width <= n; i += width) {
+    const __m512i blo = _mm512_loadu_si512(bin_lo + i);
+    const __m512i bhi = _mm512_loadu_si512(bin_hi + i);
+    const __m512i overlap = _mm512_sub_epi32(_mm512_min_epi32(vhi, bhi),
+                                             _mm512_max_epi32(vlo, blo));
+    _mm512_storeu_ps(length + i,
+                     _mm512_cvtepi32_ps(_mm512_max_epi32(overlap, zero)));
+  }
+  getOverlapLengthsScalar(lo, hi, bin_lo, bin_hi, n, length, i);
+}
+
+#pragma GCC diagnostic pop
+
+#endif  // GPL_X86_SIMD
+
+////////////////////////////////////////////////
+// Dispatch
+
+namespace {
+
+struct Kernels
+{
+  SimdLevel level;
+  void (*get_pin_box)(const int*, const int*, int, int&, int&, int&, int&);
+  void (*compute_wa_exp)(const WaExpInput&, const WaExpOutput&);
+  void (*get_overlap_lengths)(int, int, const int*, const int*, int, float*);
+};
+
+SimdLevel detectSimdLevel()
+{
+#ifdef GPL_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdLevel::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdLevel::kAvx2;
+  }
+#endif
+  return SimdLevel::kScalar;
+}
+
+Kernels selectKernels(SimdLevel level)
+{
+  switch (level) {
+#ifdef GPL_X86_SIMD
+    case SimdLevel::kAvx512:
+      return {level,
+              getPinBoxAvx512,
+              computeWaExpAvx512,
+              getOverlapLengthsAvx512};
+    case SimdLevel::kAvx2:
+      return {level, getPinBoxAvx2, computeWaExpAvx2, getOverlapLengthsAvx2};
+#endif
+    default:
+      return {SimdLevel::kScalar,
+              getPinBoxScalar,
+              computeWaExpScalar,
+              getOverlapLengthsScalar};
+  }
+}
+
+const SimdLevel max_level = detectSimdLevel();
+Kernels kernels = selectKernels(max_level);
+
+}  // namespace
+
+SimdLevel getSimdLevel()
+{
+  return kernels.level;
+}
+
+SimdLevel getMaxSimdLevel()
+{
+  return max_level;
+}
+
+void setSimdLevel(SimdLevel level)
+{
+  kernels = selectKernels(std::min(level, max_level));
+}
+
+const char* getSimdLevelName(SimdLevel level)
+{
+  switch (level) {
+    case SimdLevel::kScalar:
+      return "scalar";
+    case SimdLevel::kAvx2:
+      return "avx2";
+    case SimdLevel::kAvx512:
+      return "avx512";
+  }
+  return "unknown";
+}
+
+void getPinBox(const int* x,
+               const int* y,
+               int n,
+               int& lx,
+               int& ly,
+               int& ux,
+               int& uy)
+{
+  kernels.get_pin_box(x, y, n, lx, ly, ux, uy);
+}
+
+void computeWaExp(const WaExpInput& in, const WaExpOutput& out)
+{
+  kernels.compute_wa_exp(in, out);
+}
+
+void getOverlapLengths(int lo,
+                       int hi,
+                       const int* bin_lo,
+                       const int* bin_hi,
+                       int n,
+                       float* length)
+{
+  kernels.get_overlap_lengths(lo, hi, bin_lo, bin_hi, n, length);
+}
+
+}  // namespace gpl
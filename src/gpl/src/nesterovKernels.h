@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#pragma once
+
+namespace gpl {
+
+// Instruction set used by the kernels below. The best level supported by
+// the host is selected at startup; every level gives bit-identical results
+// to the scalar code.
+enum class SimdLevel
+{
+  kScalar,
+  kAvx2,
+  kAvx512
+};
+
+SimdLevel getSimdLevel();
+// Best level supported by the host.
+SimdLevel getMaxSimdLevel();
+// Used by the tests and the micro-benchmark to compare implementations.
+// Levels above getMaxSimdLevel() are clamped. Not thread safe.
+void setSimdLevel(SimdLevel level);
+const char* getSimdLevelName(SimdLevel level);
+
+// exp(x) approximated as (1 + x / 1024)^1024.
+// https://codingforspeed.com/using-faster-exponential-approximation/
+inline float fastExp(float exp)
+{
+  exp = 1.0f + exp / 1024.0f;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  exp *= exp;
+  return exp;
+}
+
+// Bounding box of the n points (x[i], y[i]). Gives INT_MAX/INT_MIN
+// lower/upper bounds when n is 0.
+void getPinBox(const int* x,
+               const int* y,
+               int n,
+               int& lx,
+               int& ly,
+               int& ux,
+               int& uy);
+
+// Inputs of the weighted average wirelength exponentials for n pins. Pin i
+// is at (x[i], y[i]) on net[i], whose box is given by the net_* arrays.
+struct WaExpInput
+{
+  int n = 0;
+  const int* x = nullptr;
+  const int* y = nullptr;
+  const int* net = nullptr;
+  const int* net_lx = nullptr;
+  const int* net_ly = nullptr;
+  const int* net_ux = nullptr;
+  const int* net_uy = nullptr;
+  // 1 / gamma
+  float coeff_x = 0;
+  float coeff_y = 0;
+  // Exponents at or below this are dropped.
+  float min_exp = 0;
+};
+
+// exp terms of each pin, shifted by the net box so they cannot overflow,
+// or 0 for an exponent at or below min_exp.
+struct WaExpOutput
+{
+  float* min_x = nullptr;  // exp((lx - x) / gamma)
+  float* max_x = nullptr;  // exp((x - ux) / gamma)
+  float* min_y = nullptr;  // exp((ly - y) / gamma)
+  float* max_y = nullptr;  // exp((y - uy) / gamma)
+};
+
+void computeWaExp(const WaExpInput& in, const WaExpOutput& out);
+
+// length[i] = max(0, min(hi, bin_hi[i]) - max(lo, bin_lo[i])) for the n
+// bins, the overlap of [lo, hi) with each bin along one axis.
+void getOverlapLengths(int lo,
+                       int hi,
+                       const int* bin_lo,
+                       const int* bin_hi,
+                       int n,
+                       float* length);
+
+}  // namespace gpl
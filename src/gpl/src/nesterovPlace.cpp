@@ -268,7 +268,11 @@ int NesterovPlace::doNesterovPlace(int start_iter)
   // if replace diverged in init() function,
   // replace must be skipped.
   if (num_region_diverged_ > 0) {
-    log_->error(GPL, divergeCode_, divergeMsg_);
+    if (npVars_.sweepRun) {
+      sweepWarnings_.push_back(divergeMsg_);
+    } else {
+      log_->error(GPL, divergeCode_, divergeMsg_);
+    }
     return 0;
   }
 
@@ -718,15 +722,25 @@ int NesterovPlace::doNesterovPlace(int start_iter)
       if (!npVars_.disableRevertIfDiverge && is_diverge_snapshot_saved) {
         // In case diverged and not in routability mode, finish with min hpwl
         // stored since overflow below 0.25
-        log_->warn(GPL,
-                   90,
-                   "Divergence detected, reverting to snapshot with min hpwl.");
-        log_->warn(GPL,
-                   91,
-                   "Revert to iter: {:4d} overflow: {:.3f} HPWL: {}",
-                   diverge_snapshot_iter_,
-                   diverge_snapshot_average_overflow_unscaled_,
-                   min_hpwl_);
+        if (npVars_.sweepRun) {
+          sweepWarnings_.push_back(fmt::format(
+              "Divergence detected, reverted to iter: {:4d} overflow: {:.3f} "
+              "HPWL: {}",
+              diverge_snapshot_iter_,
+              diverge_snapshot_average_overflow_unscaled_,
+              min_hpwl_));
+        } else {
+          log_->warn(
+              GPL,
+              90,
+              "Divergence detected, reverting to snapshot with min hpwl.");
+          log_->warn(GPL,
+                     91,
+                     "Revert to iter: {:4d} overflow: {:.3f} HPWL: {}",
+                     diverge_snapshot_iter_,
+                     diverge_snapshot_average_overflow_unscaled_,
+                     min_hpwl_);
+        }
         wireLengthCoefX_ = diverge_snapshot_WlCoefX;
         wireLengthCoefY_ = diverge_snapshot_WlCoefY;
         nbc_->updateWireLengthForceWA(wireLengthCoefX_, wireLengthCoefY_);
@@ -841,10 +855,16 @@ int NesterovPlace::doNesterovPlace(int start_iter)
   }
   // in all case including diverge,
   // db should be updated.
-  updateDb();
+  if (!npVars_.sweepRun) {
+    updateDb();
+  }
 
   if (num_region_diverged_ > 0) {
-    log_->error(GPL, divergeCode_, divergeMsg_);
+    if (npVars_.sweepRun) {
+      sweepWarnings_.push_back(divergeMsg_);
+    } else {
+      log_->error(GPL, divergeCode_, divergeMsg_);
+    }
   }
 
   if (graphics_ && npVars_.debug_generate_images) {
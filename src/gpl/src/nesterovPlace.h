@@ -58,6 +58,19 @@ class NesterovPlace
   float getWireLengthCoefX() const { return wireLengthCoefX_; }
   float getWireLengthCoefY() const { return wireLengthCoefY_; }
 
+  float getAverageOverflowUnscaled() const
+  {
+    return average_overflow_unscaled_;
+  }
+  bool isDiverged() const { return num_region_diverged_ > 0; }
+  int getDivergeCode() const { return divergeCode_; }
+  // Warnings of a sweep run, which are reported by the sweep instead of
+  // from its worker thread.
+  const std::vector<std::string>& getSweepWarnings() const
+  {
+    return sweepWarnings_;
+  }
+
   void setTargetOverflow(float overflow) { npVars_.targetOverflow = overflow; }
   void setMaxIters(int limit) { npVars_.maxNesterovIter = limit; }
 
@@ -121,6 +134,7 @@ class NesterovPlace
 
   std::string divergeMsg_;
   int divergeCode_ = 0;
+  std::vector<std::string> sweepWarnings_;
 
   int recursionCntWlCoef_ = 0;
   int recursionCntInitSLPCoef_ = 0;
@@ -45,6 +45,8 @@ static std::pair<int, int> getMinMaxIdx(int ll,
 
 static bool isCoreAreaOverlap(Die& die, Instance& inst);
 
+static bool isCenterInsideCore(Die& die, Instance& inst);
+
 static int64_t getOverlapWithCoreArea(Die& die, Instance& inst);
 
 ////////////////////////////////////////////////////////
@@ -993,15 +995,53 @@ PlacerBase::PlacerBase(odb::dbDatabase* db,
   init();
 }
 
+PlacerBase::PlacerBase(odb::dbDatabase* db,
+                       std::shared_ptr<PlacerBaseCommon> pbCommon,
+                       utl::Logger* log,
+                       const odb::Rect& window)
+    : PlacerBase()
+{
+  db_ = db;
+  log_ = log;
+  pbCommon_ = std::move(pbCommon);
+  initWindow(window);
+  init();
+}
+
 PlacerBase::~PlacerBase()
 {
   reset();
 }
 
-void PlacerBase::init()
+void PlacerBase::initWindow(const odb::Rect& window)
 {
+  has_window_ = true;
   die_ = pbCommon_->die();
 
+  // snap the window outwards to the site grid of the core
+  const int siteX = pbCommon_->siteSizeX();
+  const int siteY = pbCommon_->siteSizeY();
+  const int coreLx = die_.coreLx();
+  const int coreLy = die_.coreLy();
+  auto snap_down = [](int value, int origin, int step) {
+    return origin + (value - origin) / step * step;
+  };
+  auto snap_up = [](int value, int origin, int step) {
+    return origin + (value - origin + step - 1) / step * step;
+  };
+  const int lx = std::max(snap_down(window.xMin(), coreLx, siteX), coreLx);
+  const int ly = std::max(snap_down(window.yMin(), coreLy, siteY), coreLy);
+  const int ux = std::min(snap_up(window.xMax(), coreLx, siteX), die_.coreUx());
+  const int uy = std::min(snap_up(window.yMax(), coreLy, siteY), die_.coreUy());
+  die_.setCoreBox(odb::Rect(lx, ly, std::max(lx, ux), std::max(ly, uy)));
+}
+
+void PlacerBase::init()
+{
+  if (!has_window_) {
+    die_ = pbCommon_->die();
+  }
+
   // siteSize update
   siteSizeX_ = pbCommon_->siteSizeX();
   siteSizeY_ = pbCommon_->siteSizeY();
@@ -1011,11 +1051,17 @@ void PlacerBase::init()
       continue;
     }
 
-    if (inst->dbInst() && inst->dbInst()->getGroup() != group_) {
+    // In a window, instances of other groups and those outside of the
+    // window stay where they are and are only obstacles.
+    const bool other_group
+        = inst->dbInst() && inst->dbInst()->getGroup() != group_;
+    if (other_group && !has_window_) {
       continue;
     }
+    const bool frozen
+        = has_window_ && (other_group || !isCenterInsideCore(die_, *inst));
 
-    if (inst->isFixed()) {
+    if (inst->isFixed() || frozen) {
       // Check whether fixed instance is
       // within the corearea
       //
@@ -1355,6 +1401,12 @@ static bool isCoreAreaOverlap(Die& die, Instance& inst)
   return !(rectLx >= rectUx || rectLy >= rectUy);
 }
 
+static bool isCenterInsideCore(Die& die, Instance& inst)
+{
+  return inst.cx() >= die.coreLx() && inst.cx() < die.coreUx()
+         && inst.cy() >= die.coreLy() && inst.cy() < die.coreUy();
+}
+
 static int64_t getOverlapWithCoreArea(Die& die, Instance& inst)
 {
   int rectLx = std::max(die.coreLx(), inst.lx()),
@@ -353,6 +353,13 @@ class PlacerBase
              std::shared_ptr<PlacerBaseCommon> pbCommon,
              utl::Logger* log,
              odb::dbGroup* group = nullptr);
+  // Only the instances centered inside window (snapped to the site grid)
+  // are placeable; every other instance is treated as fixed and the core
+  // is reduced to the window.
+  PlacerBase(odb::dbDatabase* db,
+             std::shared_ptr<PlacerBaseCommon> pbCommon,
+             utl::Logger* log,
+             const odb::Rect& window);
   ~PlacerBase();
 
   const std::vector<Instance*>& insts() const { return insts_; }
@@ -416,8 +423,10 @@ class PlacerBase
 
   std::shared_ptr<PlacerBaseCommon> pbCommon_;
   odb::dbGroup* group_ = nullptr;
+  bool has_window_ = false;
 
   void init();
+  void initWindow(const odb::Rect& window);
   void initInstsForUnusableSites();
 
   void reset();
@@ -4,10 +4,16 @@
 #include "gpl/Replace.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
+#include "coarsening.h"
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
 #include "initialPlace.h"
@@ -15,6 +21,7 @@
 #include "nesterovBase.h"
 #include "nesterovPlace.h"
 #include "odb/db.h"
+#include "odb/geom.h"
 #include "ord/OpenRoad.hh"
 #include "placerBase.h"
 #include "routeBase.h"
@@ -44,7 +51,7 @@ void Replace::init(odb::dbDatabase* odb,
   log_ = logger;
 }
 
-void Replace::reset()
+void Replace::resetPlacers()
 {
   ip_.reset();
   np_.reset();
@@ -59,12 +66,18 @@ void Replace::reset()
 
   tb_.reset();
   rb_.reset();
+}
+
+void Replace::reset()
+{
+  resetPlacers();
 
   initialPlaceMaxIter_ = 20;
   initialPlaceMinDiffLength_ = 1500;
   initialPlaceMaxSolverIter_ = 100;
   initialPlaceMaxFanout_ = 200;
   initialPlaceNetWeightScale_ = 800;
+  initialPlacePcg_ = false;
 
   nesterovPlaceMaxIter_ = 5000;
   binGridCntX_ = binGridCntY_ = 0;
@@ -87,8 +100,13 @@ void Replace::reset()
 
   timingDrivenMode_ = true;
   keepResizeBelowOverflow_ = 1.0;
+  timingDrivenIncrementalThreshold_ = -1;
+  hasIncrementalWindow_ = false;
+  incrementalWindowMargin_ = -1;
+  clusteredPlaceMaxGCells_ = 0;
   routabilityDrivenMode_ = true;
   routabilityUseRudy_ = true;
+  routabilityIncrementalGrt_ = false;
   uniformTargetDensityMode_ = false;
   skipIoMode_ = false;
   disableRevertIfDiverge_ = false;
@@ -113,6 +131,11 @@ void Replace::addPlacementCluster(const Cluster& cluster)
 
 void Replace::doIncrementalPlace(int threads)
 {
+  if ((hasIncrementalWindow_ || incrementalWindowMargin_ >= 0)
+      && doWarmStartPlace(threads)) {
+    return;
+  }
+
   if (pbc_ == nullptr) {
     PlacerBaseVars pbVars;
     pbVars.padLeft = padLeft_;
@@ -189,6 +212,112 @@ void Replace::doIncrementalPlace(int threads)
   }
 }
 
+bool Replace::doWarmStartPlace(int threads)
+{
+  // Nesterov iterations allowed to recover from an ECO; the placement is
+  // already spread so a full run's schedule is not needed.
+  constexpr int warm_start_max_iter = 300;
+  // The density penalty normally starts small so that the cells can first
+  // spread from the initial place cluster. Here they already are.
+  constexpr float warm_start_penalty_scale = 100;
+
+  initPlacerBase();
+
+  // Lock down already placed objects, they anchor the initial place of
+  // the new ones.
+  std::vector<Instance*> unplaced;
+  for (Instance* inst : pbc_->placeInsts()) {
+    if (inst->dbInst()->getPlacementStatus().isPlaced()) {
+      inst->lock();
+    } else {
+      unplaced.push_back(inst);
+    }
+  }
+
+  odb::Rect window;
+  if (hasIncrementalWindow_) {
+    window = incrementalWindow_;
+  } else {
+    window.mergeInit();
+    for (Instance* inst : unplaced) {
+      for (Pin* pin : inst->pins()) {
+        if (pin->net() == nullptr) {
+          continue;
+        }
+        for (Pin* net_pin : pin->net()->pins()) {
+          Instance* net_inst = net_pin->instance();
+          if (net_inst == nullptr || net_inst->isLocked()
+              || net_inst->isFixed()) {
+            window.merge(odb::Point(net_pin->cx(), net_pin->cy()));
+          }
+        }
+      }
+    }
+    if (!window.isInverted()) {
+      window.bloat(incrementalWindowMargin_, window);
+    }
+  }
+
+  Die& core = pbc_->die();
+  const odb::Rect core_rect(
+      core.coreLx(), core.coreLy(), core.coreUx(), core.coreUy());
+  if (window.isInverted() || !core_rect.overlaps(window)) {
+    log_->warn(GPL,
+               111,
+               "Empty warm start window; placing the whole design "
+               "incrementally.");
+    pbc_->unlockAll();
+    return false;
+  }
+
+  if (!unplaced.empty()) {
+    doInitialPlace(threads);
+  }
+  pbc_->unlockAll();
+
+  // Initial place pulls the new instances towards their nets, which may lie
+  // outside the window. The window's PlacerBase would freeze them there
+  // unlegalized, so they are moved to the nearest location inside it.
+  const odb::Rect inside = window.intersect(core_rect);
+  auto clamp_center = [](int center, int size, int lo, int hi) {
+    lo += size / 2;
+    hi -= size - size / 2;
+    if (lo > hi) {
+      return (lo + hi) / 2;
+    }
+    return std::clamp(center, lo, hi);
+  };
+  for (Instance* inst : unplaced) {
+    inst->setCenterLocation(
+        clamp_center(inst->cx(), inst->dx(), inside.xMin(), inside.xMax()),
+        clamp_center(inst->cy(), inst->dy(), inside.yMin(), inside.yMax()));
+  }
+
+  // A single region covering the window replaces the design's regions, so
+  // that bins, fillers and the FFT only span the window.
+  pbVec_.clear();
+  pbVec_.push_back(std::make_shared<PlacerBase>(db_, pbc_, log_, window));
+  total_placeable_insts_ = pbVec_.front()->placeInsts().size();
+  Die& die = pbVec_.front()->die();
+  log_->info(GPL,
+             112,
+             "Warm start window ({}, {}) ({}, {}) with {} placeable instances.",
+             die.coreLx(),
+             die.coreLy(),
+             die.coreUx(),
+             die.coreUy(),
+             total_placeable_insts_);
+
+  const int previous_max_iter = nesterovPlaceMaxIter_;
+  const float previous_penalty = initDensityPenalityFactor_;
+  setNesterovPlaceMaxIter(std::min(previous_max_iter, warm_start_max_iter));
+  setInitDensityPenalityFactor(previous_penalty * warm_start_penalty_scale);
+  doNesterovPlace(threads);
+  setNesterovPlaceMaxIter(previous_max_iter);
+  setInitDensityPenalityFactor(previous_penalty);
+  return true;
+}
+
 void Replace::doInitialPlace(int threads)
 {
   if (pbc_ == nullptr) {
@@ -224,6 +353,7 @@ void Replace::doInitialPlace(int threads)
   ipVars.maxSolverIter = initialPlaceMaxSolverIter_;
   ipVars.maxFanout = initialPlaceMaxFanout_;
   ipVars.netWeightScale = initialPlaceNetWeightScale_;
+  ipVars.pcg = initialPlacePcg_;
   ipVars.debug = gui_debug_initial_;
 
   std::unique_ptr<InitialPlace> ip(
@@ -242,30 +372,78 @@ void Replace::runMBFF(int max_sz,
   pntset.Run(max_sz, alpha, beta);
 }
 
-bool Replace::initNesterovPlace(int threads)
+void Replace::initPlacerBase()
 {
-  if (!pbc_) {
-    PlacerBaseVars pbVars;
-    pbVars.padLeft = padLeft_;
-    pbVars.padRight = padRight_;
-    pbVars.skipIoMode = skipIoMode_;
+  if (pbc_) {
+    return;
+  }
+  PlacerBaseVars pbVars;
+  pbVars.padLeft = padLeft_;
+  pbVars.padRight = padRight_;
+  pbVars.skipIoMode = skipIoMode_;
 
-    pbc_ = std::make_shared<PlacerBaseCommon>(db_, pbVars, log_);
+  pbc_ = std::make_shared<PlacerBaseCommon>(db_, pbVars, log_);
 
-    pbVec_.push_back(std::make_shared<PlacerBase>(db_, pbc_, log_));
+  pbVec_.push_back(std::make_shared<PlacerBase>(db_, pbc_, log_));
 
-    for (auto pd : db_->getChip()->getBlock()->getPowerDomains()) {
-      if (pd->getGroup()) {
-        pbVec_.push_back(
-            std::make_shared<PlacerBase>(db_, pbc_, log_, pd->getGroup()));
-      }
+  for (auto pd : db_->getChip()->getBlock()->getPowerDomains()) {
+    if (pd->getGroup()) {
+      pbVec_.push_back(
+          std::make_shared<PlacerBase>(db_, pbc_, log_, pd->getGroup()));
     }
+  }
 
-    total_placeable_insts_ = 0;
-    for (const auto& pb : pbVec_) {
-      total_placeable_insts_ += pb->placeInsts().size();
-    }
+  total_placeable_insts_ = 0;
+  for (const auto& pb : pbVec_) {
+    total_placeable_insts_ += pb->placeInsts().size();
   }
+}
+
+NesterovBaseVars Replace::getNesterovBaseVars() const
+{
+  NesterovBaseVars nbVars;
+  nbVars.targetDensity = density_;
+
+  if (binGridCntX_ != 0 && binGridCntY_ != 0) {
+    nbVars.isSetBinCnt = true;
+    nbVars.binCntX = binGridCntX_;
+    nbVars.binCntY = binGridCntY_;
+  }
+
+  nbVars.useUniformTargetDensity = uniformTargetDensityMode_;
+  return nbVars;
+}
+
+NesterovPlaceVars Replace::getNesterovPlaceVars() const
+{
+  NesterovPlaceVars npVars;
+
+  npVars.minPhiCoef = minPhiCoef_;
+  npVars.maxPhiCoef = maxPhiCoef_;
+  npVars.referenceHpwl = referenceHpwl_;
+  npVars.routability_end_overflow = routabilityCheckOverflow_;
+  npVars.keepResizeBelowOverflow = keepResizeBelowOverflow_;
+  npVars.initDensityPenalty = initDensityPenalityFactor_;
+  npVars.initWireLengthCoef = initWireLengthCoef_;
+  npVars.targetOverflow = overflow_;
+  npVars.maxNesterovIter = nesterovPlaceMaxIter_;
+  npVars.timingDrivenMode = timingDrivenMode_;
+  npVars.routability_driven_mode = routabilityDrivenMode_;
+  npVars.debug = gui_debug_;
+  npVars.debug_pause_iterations = gui_debug_pause_iterations_;
+  npVars.debug_update_iterations = gui_debug_update_iterations_;
+  npVars.debug_draw_bins = gui_debug_draw_bins_;
+  npVars.debug_inst = gui_debug_inst_;
+  npVars.debug_start_iter = gui_debug_start_iter_;
+  npVars.debug_generate_images = gui_debug_generate_images;
+  npVars.debug_images_path = gui_debug_images_path;
+  npVars.disableRevertIfDiverge = disableRevertIfDiverge_;
+  return npVars;
+}
+
+bool Replace::initNesterovPlace(int threads)
+{
+  initPlacerBase();
 
   if (total_placeable_insts_ == 0) {
     log_->warn(GPL, 136, "No placeable instances - skipping placement.");
@@ -273,16 +451,7 @@ bool Replace::initNesterovPlace(int threads)
   }
 
   if (!nbc_) {
-    NesterovBaseVars nbVars;
-    nbVars.targetDensity = density_;
-
-    if (binGridCntX_ != 0 && binGridCntY_ != 0) {
-      nbVars.isSetBinCnt = true;
-      nbVars.binCntX = binGridCntX_;
-      nbVars.binCntY = binGridCntY_;
-    }
-
-    nbVars.useUniformTargetDensity = uniformTargetDensityMode_;
+    NesterovBaseVars nbVars = getNesterovBaseVars();
 
     nbc_ = std::make_shared<NesterovBaseCommon>(
         nbVars, pbc_, log_, threads, clusters_);
@@ -295,6 +464,7 @@ bool Replace::initNesterovPlace(int threads)
   if (!rb_) {
     RouteBaseVars rbVars;
     rbVars.useRudy = routabilityUseRudy_;
+    rbVars.incrementalGrt = routabilityIncrementalGrt_;
     rbVars.maxDensity = routabilityMaxDensity_;
     rbVars.maxInflationIter = routabilityMaxInflationIter_;
     rbVars.targetRC = routabilityTargetRcMetric_;
@@ -312,31 +482,11 @@ bool Replace::initNesterovPlace(int threads)
     tb_ = std::make_shared<TimingBase>(nbc_, rs_, log_);
     tb_->setTimingNetWeightOverflows(timingNetWeightOverflows_);
     tb_->setTimingNetWeightMax(timingNetWeightMax_);
+    tb_->setIncrementalMoveThreshold(timingDrivenIncrementalThreshold_);
   }
 
   if (!np_) {
-    NesterovPlaceVars npVars;
-
-    npVars.minPhiCoef = minPhiCoef_;
-    npVars.maxPhiCoef = maxPhiCoef_;
-    npVars.referenceHpwl = referenceHpwl_;
-    npVars.routability_end_overflow = routabilityCheckOverflow_;
-    npVars.keepResizeBelowOverflow = keepResizeBelowOverflow_;
-    npVars.initDensityPenalty = initDensityPenalityFactor_;
-    npVars.initWireLengthCoef = initWireLengthCoef_;
-    npVars.targetOverflow = overflow_;
-    npVars.maxNesterovIter = nesterovPlaceMaxIter_;
-    npVars.timingDrivenMode = timingDrivenMode_;
-    npVars.routability_driven_mode = routabilityDrivenMode_;
-    npVars.debug = gui_debug_;
-    npVars.debug_pause_iterations = gui_debug_pause_iterations_;
-    npVars.debug_update_iterations = gui_debug_update_iterations_;
-    npVars.debug_draw_bins = gui_debug_draw_bins_;
-    npVars.debug_inst = gui_debug_inst_;
-    npVars.debug_start_iter = gui_debug_start_iter_;
-    npVars.debug_generate_images = gui_debug_generate_images;
-    npVars.debug_images_path = gui_debug_images_path;
-    npVars.disableRevertIfDiverge = disableRevertIfDiverge_;
+    NesterovPlaceVars npVars = getNesterovPlaceVars();
 
     for (const auto& nb : nbVec_) {
       nb->setNpVars(&npVars);
@@ -352,6 +502,9 @@ bool Replace::initNesterovPlace(int threads)
 
 int Replace::doNesterovPlace(int threads, int start_iter)
 {
+  if (clusteredPlaceMaxGCells_ > 0 && !nbc_ && clusters_.empty()) {
+    return doClusteredPlace(threads);
+  }
   if (!initNesterovPlace(threads)) {
     return 0;
   }
@@ -381,6 +534,302 @@ int Replace::doNesterovPlace(int threads, int start_iter)
   return return_do_nesterov;
 }
 
+int Replace::doClusteredPlace(int threads)
+{
+  // The clusters only need to be roughly spread; the flat refinement
+  // resolves the rest of the overflow.
+  constexpr float coarse_overflow = 0.2f;
+  // Nesterov iterations allowed to the flat refinement, which starts from
+  // the spread clusters rather than from the initial place.
+  constexpr int refine_max_iter = 500;
+  constexpr float refine_penalty_scale = 100;
+
+  const int max_gcells = clusteredPlaceMaxGCells_;
+  clusteredPlaceMaxGCells_ = 0;
+
+  initPlacerBase();
+  if (total_placeable_insts_ > max_gcells) {
+    CoarseningVars coarseningVars;
+    coarseningVars.maxClusters = max_gcells;
+    Coarsening coarsening(coarseningVars, pbc_, log_);
+    clusters_ = coarsening.coarsen();
+  }
+  if (clusters_.empty()) {
+    const int iter = doNesterovPlace(threads);
+    clusteredPlaceMaxGCells_ = max_gcells;
+    return iter;
+  }
+
+  int clustered_insts = 0;
+  for (const Cluster& cluster : clusters_) {
+    clustered_insts += cluster.size();
+  }
+  log_->info(GPL,
+             125,
+             "Clustered {} of {} instances into {} clusters, placing {} "
+             "GCells.",
+             clustered_insts,
+             total_placeable_insts_,
+             clusters_.size(),
+             total_placeable_insts_ - clustered_insts + clusters_.size());
+
+  // Timing and routability are only worth their runtime on the flat
+  // netlist.
+  const bool previous_timing_driven = timingDrivenMode_;
+  const bool previous_routability_driven = routabilityDrivenMode_;
+  const bool previous_routing_congestion = enable_routing_congestion_;
+  const float previous_overflow = overflow_;
+  timingDrivenMode_ = false;
+  routabilityDrivenMode_ = false;
+  enable_routing_congestion_ = false;
+  overflow_ = std::max(coarse_overflow, overflow_);
+  int iter = doNesterovPlace(threads);
+  timingDrivenMode_ = previous_timing_driven;
+  routabilityDrivenMode_ = previous_routability_driven;
+  enable_routing_congestion_ = previous_routing_congestion;
+  overflow_ = previous_overflow;
+
+  // Decluster: the members of a cluster are stacked at its center in the
+  // db, pack them in rows over the cluster's footprint instead.
+  const int pad_x = pbc_->siteSizeX() * pbc_->padLeft();
+  for (const Cluster& cluster : clusters_) {
+    const GCell* gcell = nbc_->pbToNb(pbc_->dbToPb(cluster.front()));
+    int x = gcell->lx();
+    int y = gcell->ly();
+    int row_height = 0;
+    for (odb::dbInst* db_inst : cluster) {
+      const Instance* inst = pbc_->dbToPb(db_inst);
+      if (x > gcell->lx() && x + inst->dx() > gcell->ux()) {
+        x = gcell->lx();
+        y += row_height;
+        row_height = 0;
+      }
+      db_inst->setLocation(x + pad_x, y);
+      x += inst->dx();
+      row_height = std::max(row_height, inst->dy());
+    }
+  }
+  clusters_.clear();
+
+  // Rebuild the flat netlist from the declustered locations and refine it
+  // like a warm start.
+  resetPlacers();
+  log_->info(
+      GPL, 126, "Refining {} declustered instances.", total_placeable_insts_);
+  const int previous_max_iter = nesterovPlaceMaxIter_;
+  const float previous_penalty = initDensityPenalityFactor_;
+  setNesterovPlaceMaxIter(std::min(previous_max_iter, refine_max_iter));
+  setInitDensityPenalityFactor(previous_penalty * refine_penalty_scale);
+  iter += doNesterovPlace(threads);
+  setNesterovPlaceMaxIter(previous_max_iter);
+  setInitDensityPenalityFactor(previous_penalty);
+
+  clusteredPlaceMaxGCells_ = max_gcells;
+  return iter;
+}
+
+std::vector<NesterovSweepResult> Replace::doNesterovPlaceSweep(
+    const std::vector<NesterovSweepRun>& runs,
+    int threads,
+    bool apply_best)
+{
+  std::vector<NesterovSweepResult> results(runs.size());
+  initPlacerBase();
+  if (total_placeable_insts_ == 0) {
+    log_->warn(GPL, 141, "No placeable instances - skipping placement.");
+    return results;
+  }
+  if (runs.empty()) {
+    return results;
+  }
+
+  const int concurrency = std::min<int>(runs.size(), std::max(threads, 1));
+  const int run_threads = std::max(threads / concurrency, 1);
+  log_->info(GPL,
+             104,
+             "Sweeping {} Nesterov runs, {} at a time with {} threads each.",
+             runs.size(),
+             concurrency,
+             run_threads);
+
+  // Everything a run changes; pbc_ and pbVec_ are shared.
+  struct SweepState
+  {
+    NesterovPlaceVars npVars;
+    std::shared_ptr<NesterovBaseCommon> nbc;
+    std::vector<std::shared_ptr<NesterovBase>> nbVec;
+    std::shared_ptr<RouteBase> rb;
+    std::shared_ptr<TimingBase> tb;
+    std::unique_ptr<NesterovPlace> np;
+  };
+
+  // NesterovBase's constructor jitters the shared instances, so every run
+  // is set up serially from the same starting locations.
+  const std::vector<Instance*>& insts = pbc_->placeInsts();
+  std::vector<odb::Point> start_locations;
+  start_locations.reserve(insts.size());
+  for (const Instance* inst : insts) {
+    start_locations.emplace_back(inst->lx(), inst->ly());
+  }
+  auto restore_locations = [&]() {
+    for (size_t i = 0; i < insts.size(); i++) {
+      insts[i]->setLocation(start_locations[i].x(), start_locations[i].y());
+    }
+  };
+
+  std::vector<std::unique_ptr<SweepState>> states;
+  for (size_t i = 0; i < runs.size(); i++) {
+    const NesterovSweepRun& run = runs[i];
+    restore_locations();
+    auto state = std::make_unique<SweepState>();
+
+    NesterovBaseVars nbVars = getNesterovBaseVars();
+    if (run.targetDensity > 0) {
+      nbVars.targetDensity = run.targetDensity;
+      nbVars.useUniformTargetDensity = false;
+    }
+    state->nbc = std::make_shared<NesterovBaseCommon>(
+        nbVars, pbc_, log_, run_threads, clusters_);
+    for (const auto& pb : pbVec_) {
+      state->nbVec.push_back(
+          std::make_shared<NesterovBase>(nbVars, pb, state->nbc, log_));
+    }
+
+    state->npVars = getNesterovPlaceVars();
+    if (run.targetOverflow > 0) {
+      state->npVars.targetOverflow = run.targetOverflow;
+    }
+    state->npVars.timingDrivenMode = false;
+    state->npVars.routability_driven_mode = false;
+    state->npVars.debug = false;
+    state->npVars.sweepRun = true;
+    for (const auto& nb : state->nbVec) {
+      nb->setNpVars(&state->npVars);
+    }
+
+    state->rb = std::make_shared<RouteBase>(
+        RouteBaseVars(), db_, fr_, state->nbc, state->nbVec, log_);
+    state->tb = std::make_shared<TimingBase>(state->nbc, rs_, log_);
+    // NesterovPlace registers metrics on construction, which is not safe
+    // to do from the worker threads.
+    try {
+      state->np = std::make_unique<NesterovPlace>(state->npVars,
+                                                  pbc_,
+                                                  state->nbc,
+                                                  pbVec_,
+                                                  state->nbVec,
+                                                  state->rb,
+                                                  state->tb,
+                                                  log_);
+    } catch (const std::exception& e) {
+      // the error has already been reported through log_->error
+      state->np.reset();
+      results[i].error = e.what();
+    }
+    states.push_back(std::move(state));
+  }
+  restore_locations();
+
+  std::atomic<size_t> next_run = 0;
+  auto worker = [&]() {
+    for (size_t i = next_run++; i < states.size(); i = next_run++) {
+      SweepState& state = *states[i];
+      NesterovSweepResult& result = results[i];
+      if (!state.np) {
+        continue;
+      }
+      // A sweep run does not log from here; divergence and warnings come
+      // back through the result and are reported after the join.
+      try {
+        result.iterations = state.np->doNesterovPlace();
+        if (state.np->isDiverged()) {
+          result.diverged = true;
+          result.error = fmt::format("GPL-{:04d}", state.np->getDivergeCode());
+        }
+      } catch (const std::exception& e) {
+        result.error = e.what();
+      }
+      result.warnings = state.np->getSweepWarnings();
+      result.overflow = state.np->getAverageOverflowUnscaled();
+      result.hpwl = state.nbc->getHpwl();
+    }
+  };
+  std::vector<std::thread> workers;
+  for (int i = 1; i < concurrency; i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+
+  // The runs' iteration reports were buffered, print them one at a time.
+  for (size_t i = 0; i < states.size(); i++) {
+    for (const auto& nb : states[i]->nbVec) {
+      if (!nb->getSweepReport().empty()) {
+        log_->report("Sweep run {}:", i);
+        log_->reportLiteral(nb->getSweepReport());
+      }
+    }
+  }
+
+  int best = -1;
+  log_->report("Run  Density  Target overflow  Iterations  Overflow  HPWL");
+  for (size_t i = 0; i < runs.size(); i++) {
+    NesterovSweepResult& result = results[i];
+    result.targetDensity = states[i]->nbVec[0]->getTargetDensity();
+    result.targetOverflow = states[i]->npVars.targetOverflow;
+    std::string status;
+    if (result.diverged) {
+      status = " (diverged)";
+    } else if (!result.error.empty()) {
+      status = fmt::format(" (stopped by {})", result.error);
+    }
+    log_->report("{:3}  {:7.3f}  {:15.3f}  {:10}  {:8.3f}  {}{}",
+                 i,
+                 result.targetDensity,
+                 result.targetOverflow,
+                 result.iterations,
+                 result.overflow,
+                 result.hpwl,
+                 status);
+    if (result.error.empty()
+        && (best < 0 || result.hpwl < results[best].hpwl)) {
+      best = i;
+    }
+  }
+  for (size_t i = 0; i < results.size(); i++) {
+    for (const std::string& warning : results[i].warnings) {
+      log_->warn(GPL, 142, "Sweep run {}: {}", i, warning);
+    }
+  }
+
+  if (apply_best && best >= 0) {
+    log_->info(GPL, 109, "Writing sweep run {} to the db.", best);
+    NesterovBaseCommon* nbc = states[best]->nbc.get();
+    // the run's NesterovPlace callback must not be registered on the block
+    nbc->setCbk(nullptr);
+    nbc->updateDbGCells();
+  }
+  return results;
+}
+
+void Replace::setIncrementalWindow(const odb::Rect& window)
+{
+  incrementalWindow_ = window;
+  hasIncrementalWindow_ = true;
+}
+
+void Replace::setIncrementalWindowMargin(int margin)
+{
+  incrementalWindowMargin_ = margin;
+}
+
+void Replace::setClusteredPlaceMaxGCells(int max_gcells)
+{
+  clusteredPlaceMaxGCells_ = max_gcells;
+}
+
 void Replace::setInitialPlaceMaxIter(int iter)
 {
   initialPlaceMaxIter_ = iter;
@@ -401,6 +850,11 @@ void Replace::setInitialPlaceMaxFanout(int fanout)
   initialPlaceMaxFanout_ = fanout;
 }
 
+void Replace::setInitialPlacePcg(bool pcg)
+{
+  initialPlacePcg_ = pcg;
+}
+
 void Replace::setInitialPlaceNetWeightScale(float scale)
 {
   initialPlaceNetWeightScale_ = scale;
@@ -522,6 +976,11 @@ void Replace::setRoutabilityUseGrt(bool mode)
   routabilityUseRudy_ = !mode;
 }
 
+void Replace::setRoutabilityIncrementalGrt(bool mode)
+{
+  routabilityIncrementalGrt_ = mode;
+}
+
 void Replace::setRoutabilityCheckOverflow(float overflow)
 {
   routabilityCheckOverflow_ = overflow;
@@ -532,6 +991,11 @@ void Replace::setKeepResizeBelowOverflow(float overflow)
   keepResizeBelowOverflow_ = overflow;
 }
 
+void Replace::setTimingDrivenIncrementalThreshold(int threshold)
+{
+  timingDrivenIncrementalThreshold_ = threshold;
+}
+
 void Replace::setRoutabilityMaxDensity(float density)
 {
   routabilityMaxDensity_ = density;
@@ -2,6 +2,8 @@
 // Copyright (c) 2020-2025, The OpenROAD Authors
 
 %{
+#include <algorithm>
+
 #include "ord/OpenRoad.hh"
 #include "gpl/Replace.h"
 #include "odb/db.h"
@@ -22,10 +24,37 @@ using gpl::Replace;
 %}
 
 %import <std_vector.i>
+%template(gpl_float_vector) std::vector<float>;
 %import "dbtypes.i"
 %import "dbenums.i"
 %include "../../Exception.i"
 
+// One dict per sweep run, in run order.
+%typemap(out) std::vector<gpl::NesterovSweepResult> {
+  Tcl_Obj* list = Tcl_NewListObj(0, nullptr);
+  for (const gpl::NesterovSweepResult& result : $1) {
+    Tcl_Obj* dict = Tcl_NewDictObj();
+    auto put = [&](const char* key, Tcl_Obj* value) {
+      Tcl_DictObjPut(interp, dict, Tcl_NewStringObj(key, -1), value);
+    };
+    put("density", Tcl_NewDoubleObj(result.targetDensity));
+    put("target_overflow", Tcl_NewDoubleObj(result.targetOverflow));
+    put("iterations", Tcl_NewIntObj(result.iterations));
+    put("overflow", Tcl_NewDoubleObj(result.overflow));
+    put("hpwl", Tcl_NewWideIntObj(result.hpwl));
+    put("diverged", Tcl_NewBooleanObj(result.diverged));
+    put("error", Tcl_NewStringObj(result.error.c_str(), -1));
+    Tcl_Obj* warnings = Tcl_NewListObj(0, nullptr);
+    for (const std::string& warning : result.warnings) {
+      Tcl_ListObjAppendElement(
+          interp, warnings, Tcl_NewStringObj(warning.c_str(), -1));
+    }
+    put("warnings", warnings);
+    Tcl_ListObjAppendElement(interp, list, dict);
+  }
+  Tcl_SetObjResult(interp, list);
+}
+
 %inline %{
 
 void
@@ -58,6 +87,29 @@ replace_nesterov_place_cmd()
   replace->doNesterovPlace(threads);
 }
 
+std::vector<gpl::NesterovSweepResult>
+replace_nesterov_place_sweep_cmd(const std::vector<float>& densities,
+                                 const std::vector<float>& overflows)
+{
+  Replace* replace = getReplace();
+  int threads = ord::OpenRoad::openRoad()->getThreadCount();
+
+  // An empty list keeps the global_placement setting.
+  std::vector<gpl::NesterovSweepRun> runs;
+  for (size_t i = 0; i < std::max<size_t>(densities.size(), 1); i++) {
+    for (size_t j = 0; j < std::max<size_t>(overflows.size(), 1); j++) {
+      gpl::NesterovSweepRun run;
+      if (!densities.empty()) {
+        run.targetDensity = densities[i];
+      }
+      if (!overflows.empty()) {
+        run.targetOverflow = overflows[j];
+      }
+      runs.push_back(run);
+    }
+  }
+  return replace->doNesterovPlaceSweep(runs, threads, true);
+}
 
 void
 replace_run_mbff_cmd(int max_sz, float alpha, float beta, int num_paths) 
@@ -96,6 +148,13 @@ set_initial_place_max_fanout_cmd(int fanout)
   replace->setInitialPlaceMaxFanout(fanout);
 }
 
+void
+set_initial_place_pcg_cmd(bool pcg)
+{
+  Replace* replace = getReplace();
+  replace->setInitialPlacePcg(pcg);
+}
+
 void
 set_nesv_place_iter_cmd(int iter)
 {
@@ -160,6 +219,26 @@ replace_incremental_place_cmd()
   replace->doIncrementalPlace(threads);
 }
 
+void
+set_incremental_window_cmd(int lx, int ly, int ux, int uy)
+{
+  Replace* replace = getReplace();
+  replace->setIncrementalWindow(odb::Rect(lx, ly, ux, uy));
+}
+
+void
+set_incremental_window_margin_cmd(int margin)
+{
+  Replace* replace = getReplace();
+  replace->setIncrementalWindowMargin(margin);
+}
+
+void
+set_clustered_place_max_gcells_cmd(int max_gcells)
+{
+  Replace* replace = getReplace();
+  replace->setClusteredPlaceMaxGCells(max_gcells);
+}
 
 void set_timing_driven_mode(bool timing_driven)
 {
@@ -175,6 +254,13 @@ set_keep_resize_below_overflow_cmd(float overflow)
   replace->setKeepResizeBelowOverflow(overflow);
 }
 
+void
+set_timing_driven_incremental_threshold_cmd(int threshold)
+{
+  Replace* replace = getReplace();
+  replace->setTimingDrivenIncrementalThreshold(threshold);
+}
+
 void
 set_routability_driven_mode(bool routability_driven)
 {
@@ -189,6 +275,13 @@ set_routability_use_grt(bool use_grt)
   replace->setRoutabilityUseGrt(use_grt);
 }
 
+void
+set_routability_incremental_grt(bool incremental)
+{
+  Replace* replace = getReplace();
+  replace->setRoutabilityIncrementalGrt(incremental);
+}
+
 void
 set_routability_check_overflow_cmd(float overflow) 
 {
@@ -9,6 +9,8 @@ sta::define_cmd_args "global_placement" {\
     [-disable_timing_driven]\
     [-disable_routability_driven]\
     [-incremental]\
+    [-incremental_window {lx ly ux uy}]\
+    [-incremental_window_margin incremental_window_margin]\
     [-skip_io]\
     [-bin_grid_count grid_count]\
     [-density target_density]\
@@ -20,7 +22,9 @@ sta::define_cmd_args "global_placement" {\
     [-overflow overflow]\
     [-initial_place_max_iter initial_place_max_iter]\
     [-initial_place_max_fanout initial_place_max_fanout]\
+    [-initial_place_pcg]\
     [-routability_use_grt]\
+    [-routability_incremental_grt]\
     [-routability_target_rc_metric routability_target_rc_metric]\
     [-routability_check_overflow routability_check_overflow]\
     [-routability_max_density routability_max_density]\
@@ -32,6 +36,10 @@ sta::define_cmd_args "global_placement" {\
     [-timing_driven_net_reweight_overflow timing_driven_net_reweight_overflow]\
     [-timing_driven_net_weight_max timing_driven_net_weight_max]\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
+    [-timing_driven_incremental_threshold timing_driven_incremental_threshold]\
+    [-sweep_densities sweep_densities]\
+    [-sweep_overflows sweep_overflows]\
+    [-cluster_gcells cluster_gcells]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
     [-disable_revert_if_diverge]\
@@ -54,13 +62,18 @@ proc global_placement { args } {
       -timing_driven_net_reweight_overflow \
       -timing_driven_net_weight_max \
       -timing_driven_nets_percentage \
+      -timing_driven_incremental_threshold \
       -keep_resize_below_overflow \
+      -incremental_window -incremental_window_margin \
+      -sweep_densities -sweep_overflows -cluster_gcells \
       -pad_left -pad_right} \
     flags {-skip_initial_place \
       -skip_nesterov_place \
+      -initial_place_pcg \
       -timing_driven \
       -routability_driven \
       -routability_use_grt \
+      -routability_incremental_grt \
       -disable_timing_driven \
       -disable_routability_driven \
       -skip_io \
@@ -77,6 +90,8 @@ proc global_placement { args } {
     gpl::set_initial_place_max_iter_cmd $initial_place_max_iter
   }
 
+  gpl::set_initial_place_pcg_cmd [info exists flags(-initial_place_pcg)]
+
   if { [info exists flags(-force_cpu)] } {
     utl::warn "GPL" 152 "-force_cpu is deprecated."
   }
@@ -123,6 +138,13 @@ proc global_placement { args } {
     if { [info exists keys(-timing_driven_nets_percentage)] } {
       rsz::set_worst_slack_nets_percent $keys(-timing_driven_nets_percentage)
     }
+
+    if { [info exists keys(-timing_driven_incremental_threshold)] } {
+      set threshold $keys(-timing_driven_incremental_threshold)
+      sta::check_positive_float "-timing_driven_incremental_threshold" $threshold
+      gpl::set_timing_driven_incremental_threshold_cmd \
+        [ord::microns_to_dbu $threshold]
+    }
   }
 
   if { [info exists flags(-disable_timing_driven)] } {
@@ -141,8 +163,11 @@ proc global_placement { args } {
     utl::warn "GPL" 116 "-disable_routability_driven is deprecated."
   }
 
-  set routability_use_grt [info exists flags(-routability_use_grt)]
+  set routability_incremental_grt [info exists flags(-routability_incremental_grt)]
+  set routability_use_grt [expr {[info exists flags(-routability_use_grt)]
+                                 || $routability_incremental_grt}]
   gpl::set_routability_use_grt $routability_use_grt
+  gpl::set_routability_incremental_grt $routability_incremental_grt
   if { $routability_driven } {
     if { $routability_use_grt } {
       utl::warn "GPL" 152 \
@@ -207,6 +232,30 @@ proc global_placement { args } {
     gpl::set_max_phi_coef_cmd $max_phi_coef
   }
 
+  # warm start of incremental placement
+  if { ([info exists keys(-incremental_window)] \
+        || [info exists keys(-incremental_window_margin)]) \
+       && ![info exists flags(-incremental)] } {
+    utl::error GPL 124 "-incremental_window(_margin) requires -incremental."
+  }
+  if { [info exists keys(-incremental_window)] } {
+    set window $keys(-incremental_window)
+    if { [llength $window] != 4 } {
+      utl::error GPL 123 "-incremental_window must be a list of 4 values."
+    }
+    set window_dbu {}
+    foreach coord $window {
+      sta::check_positive_float "-incremental_window" $coord
+      lappend window_dbu [ord::microns_to_dbu $coord]
+    }
+    gpl::set_incremental_window_cmd {*}$window_dbu
+  }
+  if { [info exists keys(-incremental_window_margin)] } {
+    set margin $keys(-incremental_window_margin)
+    sta::check_positive_float "-incremental_window_margin" $margin
+    gpl::set_incremental_window_margin_cmd [ord::microns_to_dbu $margin]
+  }
+
   if { [info exists keys(-init_density_penalty)] } {
     set density_penalty $keys(-init_density_penalty)
     sta::check_positive_float "-init_density_penalty" $density_penalty
@@ -284,6 +333,43 @@ proc global_placement { args } {
     gpl::set_routability_rc_coefficients_cmd $k1 $k2 $k3 $k4
   }
 
+  # multi-start nesterov sweep
+  set sweep_densities {}
+  set sweep_overflows {}
+  set sweep [expr { [info exists keys(-sweep_densities)] \
+                      || [info exists keys(-sweep_overflows)] }]
+  if { [info exists keys(-sweep_densities)] } {
+    set sweep_densities $keys(-sweep_densities)
+    foreach density $sweep_densities {
+      sta::check_positive_float "-sweep_densities" $density
+      if { $density > 1.0 } {
+        utl::error GPL 139 "-sweep_densities values must be in \[0, 1\]."
+      }
+    }
+  }
+  if { [info exists keys(-sweep_overflows)] } {
+    set sweep_overflows $keys(-sweep_overflows)
+    foreach overflow $sweep_overflows {
+      sta::check_positive_float "-sweep_overflows" $overflow
+      if { $overflow > 1.0 } {
+        utl::error GPL 140 "-sweep_overflows values must be in \[0, 1\]."
+      }
+    }
+  }
+  if { $sweep && $timing_driven } {
+    utl::warn GPL 128 "-timing_driven is not applied to sweep runs."
+  }
+  if { $sweep && $routability_driven } {
+    utl::warn GPL 129 "-routability_driven is not applied to sweep runs."
+  }
+
+  # coarsen-place-uncoarsen for very large designs
+  if { [info exists keys(-cluster_gcells)] } {
+    set cluster_gcells $keys(-cluster_gcells)
+    sta::check_positive_integer "-cluster_gcells" $cluster_gcells
+    gpl::set_clustered_place_max_gcells_cmd $cluster_gcells
+  }
+
   # temp code.
   if { [info exists keys(-pad_left)] } {
     set pad_left $keys(-pad_left)
@@ -299,16 +385,23 @@ proc global_placement { args } {
   if { [ord::db_has_rows] } {
     sta::check_argc_eq0 "global_placement" $args
 
+    set sweep_results {}
     if { [info exists flags(-incremental)] } {
       gpl::replace_incremental_place_cmd
     } else {
       gpl::replace_initial_place_cmd
 
       if { ![info exists flags(-skip_nesterov_place)] } {
-        gpl::replace_nesterov_place_cmd
+        if { $sweep } {
+          set sweep_results \
+            [gpl::replace_nesterov_place_sweep_cmd $sweep_densities $sweep_overflows]
+        } else {
+          gpl::replace_nesterov_place_cmd
+        }
       }
     }
     gpl::replace_reset_cmd
+    return $sweep_results
   } else {
     utl::error GPL 130 "No rows defined in design. Use initialize_floorplan to add rows."
   }
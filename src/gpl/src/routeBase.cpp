@@ -228,6 +228,7 @@ void RouteBaseVars::reset()
   rcK3 = rcK4 = 0.0;
   maxInflationIter = 4;
   useRudy = true;
+  incrementalGrt = false;
 }
 
 /////////////////////////////////////////////
@@ -251,7 +252,10 @@ RouteBase::RouteBase(RouteBaseVars rbVars,
   init();
 }
 
-RouteBase::~RouteBase() = default;
+RouteBase::~RouteBase()
+{
+  clearIncrementalRoutes();
+}
 
 void RouteBase::reset()
 {
@@ -268,6 +272,7 @@ void RouteBase::reset()
 
   nbc_->resetMinRcCellSize();
 
+  clearIncrementalRoutes();
   resetRoutabilityResources();
 }
 
@@ -275,12 +280,21 @@ void RouteBase::resetRoutabilityResources()
 {
   inflatedAreaDelta_ = 0;
 
-  if (!rbVars_.useRudy) {
+  // incremental mode keeps the routes for the next round
+  if (!rbVars_.useRudy && !incrGroute_) {
     grouter_->clear();
   }
   tg_.reset();
 }
 
+void RouteBase::clearIncrementalRoutes()
+{
+  if (incrGroute_) {
+    incrGroute_.reset();
+    grouter_->clear();
+  }
+}
+
 void RouteBase::init()
 {
   // tg_ init
@@ -309,7 +323,23 @@ void RouteBase::getGrtResult()
   // this option must be off
   grouter_->setCriticalNetsPercentage(0);
 
-  grouter_->globalRoute();
+  if (incrGroute_) {
+    // only nets whose pins changed GCells are rerouted
+    debugPrint(log_,
+               GPL,
+               "incremental_grt",
+               1,
+               "Incremental global route of {} of {} nets",
+               grouter_->getDirtyNets().size(),
+               db_->getChip()->getBlock()->getNets().size());
+    incrGroute_->updateRoutes();
+  } else {
+    grouter_->globalRoute();
+    if (rbVars_.incrementalGrt) {
+      incrGroute_ = std::make_unique<grt::IncrementalGRoute>(
+          grouter_, db_->getChip()->getBlock());
+    }
+  }
 
   updateGrtRoute();
 }
@@ -555,6 +585,7 @@ std::pair<bool, bool> RouteBase::routability()
                "congestion({:.4f}), "
                "end routability optimization.",
                rbVars_.targetRC);
+    clearIncrementalRoutes();
     resetRoutabilityResources();
     return std::make_pair(false, false);
   }
@@ -720,6 +751,7 @@ std::pair<bool, bool> RouteBase::routability()
     nbVec_[0]->setTargetDensity(minRcTargetDensity_);
     nbc_->revertGCellSizeToMinRc();
     nbVec_[0]->updateDensitySize();
+    clearIncrementalRoutes();
     resetRoutabilityResources();
 
     return std::make_pair(false, true);
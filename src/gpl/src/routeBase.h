@@ -14,6 +14,7 @@ class dbDatabase;
 
 namespace grt {
 class GlobalRouter;
+class IncrementalGRoute;
 }
 
 namespace utl {
@@ -124,6 +125,9 @@ class RouteBaseVars
 {
  public:
   bool useRudy;
+  // With grt, keep FastRoute's grid and routes between rounds and only
+  // reroute nets whose pins moved.
+  bool incrementalGrt;
   float targetRC;
   float inflationRatioCoef;
   float maxInflationRatio;
@@ -183,6 +187,9 @@ class RouteBase
 
   std::unique_ptr<TileGrid> tg_;
 
+  // Tracks the nets dirtied by cell moves between incremental grt rounds.
+  std::unique_ptr<grt::IncrementalGRoute> incrGroute_;
+
   int64_t inflatedAreaDelta_ = 0;
 
   int numCall_ = 0;
@@ -198,6 +205,7 @@ class RouteBase
   void init();
   void reset();
   void resetRoutabilityResources();
+  void clearIncrementalRoutes();
 
   // update numCall_
   void increaseCounter();
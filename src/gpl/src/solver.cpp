@@ -5,8 +5,62 @@
 
 #include <omp.h>
 
+#include <algorithm>
+#include <thread>
+
 namespace gpl {
 
+// Eigen's thread count is process wide; put back the caller's setting when
+// the solve returns.
+class EigenThreadsGuard
+{
+ public:
+  explicit EigenThreadsGuard(int threads) : saved_threads_(Eigen::nbThreads())
+  {
+    Eigen::setNbThreads(threads);
+  }
+  ~EigenThreadsGuard() { Eigen::setNbThreads(saved_threads_); }
+
+ private:
+  const int saved_threads_;
+};
+
+static float bicgstabSolve(int maxSolverIter,
+                           const SMatrix& placeInstForceMatrix,
+                           const Eigen::VectorXf& fixedInstForceVec,
+                           Eigen::VectorXf& instLocVec)
+{
+  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
+  solver.setMaxIterations(maxSolverIter);
+  solver.compute(placeInstForceMatrix);
+  instLocVec = solver.solveWithGuess(fixedInstForceVec, instLocVec);
+  return solver.error();
+}
+
+// The B2B matrices are symmetric and diagonally dominant, so Jacobi
+// preconditioned CG applies. BiCGSTAB is kept for the case where CG breaks
+// down.
+static float pcgSolve(int maxSolverIter,
+                      const SMatrix& placeInstForceMatrix,
+                      const Eigen::VectorXf& fixedInstForceVec,
+                      Eigen::VectorXf& instLocVec)
+{
+  ConjugateGradient<SMatrix,
+                    Eigen::Lower | Eigen::Upper,
+                    DiagonalPreconditioner<float>>
+      cg;
+  cg.setMaxIterations(maxSolverIter);
+  cg.compute(placeInstForceMatrix);
+  Eigen::VectorXf result = cg.solveWithGuess(fixedInstForceVec, instLocVec);
+  if (cg.info() != Eigen::NumericalIssue) {
+    instLocVec = std::move(result);
+    return cg.error();
+  }
+
+  return bicgstabSolve(
+      maxSolverIter, placeInstForceMatrix, fixedInstForceVec, instLocVec);
+}
+
 ResidualError cpuSparseSolve(int maxSolverIter,
                              int iter,
                              SMatrix& placeInstForceMatrixX,
@@ -16,20 +70,39 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              Eigen::VectorXf& fixedInstForceVecY,
                              Eigen::VectorXf& instLocVecY,
                              utl::Logger* logger,
-                             int threads)
+                             int threads,
+                             bool pcg)
 {
   omp_set_num_threads(threads);
 
   ResidualError error;
-  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
-  solver.setMaxIterations(maxSolverIter);
-  solver.compute(placeInstForceMatrixX);
-  instLocVecX = solver.solveWithGuess(fixedInstForceVecX, instLocVecX);
-  error.x = solver.error();
+  if (!pcg) {
+    error.x = bicgstabSolve(
+        maxSolverIter, placeInstForceMatrixX, fixedInstForceVecX, instLocVecX);
+    error.y = bicgstabSolve(
+        maxSolverIter, placeInstForceMatrixY, fixedInstForceVecY, instLocVecY);
+    return error;
+  }
+
+  if (threads <= 1) {
+    EigenThreadsGuard eigen_threads(1);
+    error.x = pcgSolve(
+        maxSolverIter, placeInstForceMatrixX, fixedInstForceVecX, instLocVecX);
+    error.y = pcgSolve(
+        maxSolverIter, placeInstForceMatrixY, fixedInstForceVecY, instLocVecY);
+    return error;
+  }
 
-  solver.compute(placeInstForceMatrixY);
-  instLocVecY = solver.solveWithGuess(fixedInstForceVecY, instLocVecY);
-  error.y = solver.error();
+  // X and Y are independent; each solve gets half of the threads for
+  // Eigen's parallel matrix-vector products.
+  EigenThreadsGuard eigen_threads(std::max(threads / 2, 1));
+  std::thread solveY([&]() {
+    error.y = pcgSolve(
+        maxSolverIter, placeInstForceMatrixY, fixedInstForceVecY, instLocVecY);
+  });
+  error.x = pcgSolve(
+      maxSolverIter, placeInstForceMatrixX, fixedInstForceVecX, instLocVecX);
+  solveY.join();
   return error;
 }
 }  // namespace gpl
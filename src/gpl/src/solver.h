@@ -25,6 +25,8 @@ struct ResidualError
 };
 
 using Eigen::BiCGSTAB;
+using Eigen::ConjugateGradient;
+using Eigen::DiagonalPreconditioner;
 using Eigen::IdentityPreconditioner;
 using utl::GPL;
 
@@ -39,5 +41,6 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              Eigen::VectorXf& fixedInstForceVecY,
                              Eigen::VectorXf& instLocVecY,
                              utl::Logger* logger,
-                             int threads);
+                             int threads,
+                             bool pcg);
 }  // namespace gpl
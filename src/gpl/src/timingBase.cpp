@@ -6,11 +6,15 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "nesterovBase.h"
+#include "odb/db.h"
+#include "odb/geom.h"
 #include "placerBase.h"
 #include "rsz/Resizer.hh"
 #include "sta/Fuzzy.hh"
@@ -115,14 +119,89 @@ void TimingBase::setTimingNetWeightMax(float max)
   net_weight_max_ = max;
 }
 
+void TimingBase::setIncrementalMoveThreshold(int threshold)
+{
+  incremental_move_threshold_ = threshold;
+}
+
+std::vector<odb::dbNet*> TimingBase::findMovedNets(
+    std::vector<size_t>& moved_gcells) const
+{
+  std::vector<odb::dbNet*> nets;
+  const std::vector<GCell*>& gCells = nbc_->getGCells();
+  for (size_t i = 0; i < gCells.size(); i++) {
+    const GCell* gCell = gCells[i];
+    // cells created since the last update count as moved
+    if (i < gcell_locations_.size()) {
+      const odb::Point& prev = gcell_locations_[i];
+      const int64_t dist = std::abs(int64_t(gCell->dCx()) - prev.x())
+                           + std::abs(int64_t(gCell->dCy()) - prev.y());
+      if (dist <= incremental_move_threshold_) {
+        continue;
+      }
+    }
+    moved_gcells.push_back(i);
+    for (const GPin* gPin : gCell->gPins()) {
+      if (gPin->gNet()) {
+        nets.push_back(gPin->gNet()->net()->dbNet());
+      }
+    }
+  }
+  std::sort(nets.begin(), nets.end());
+  nets.erase(std::unique(nets.begin(), nets.end()), nets.end());
+  return nets;
+}
+
+void TimingBase::saveGCellLocations()
+{
+  const std::vector<GCell*>& gCells = nbc_->getGCells();
+  gcell_locations_.resize(gCells.size());
+  for (size_t i = 0; i < gCells.size(); i++) {
+    gcell_locations_[i] = {gCells[i]->dCx(), gCells[i]->dCy()};
+  }
+}
+
+// Only the moved cells had all of their nets re-estimated. The others keep
+// their reference, so their drift keeps accumulating until it crosses the
+// threshold.
+void TimingBase::saveGCellLocations(const std::vector<size_t>& gcells)
+{
+  const std::vector<GCell*>& gCells = nbc_->getGCells();
+  gcell_locations_.resize(gCells.size());
+  for (const size_t i : gcells) {
+    gcell_locations_[i] = {gCells[i]->dCx(), gCells[i]->dCy()};
+  }
+}
+
 bool TimingBase::executeTimingDriven(bool run_journal_restore)
 {
-  rs_->findResizeSlacks(run_journal_restore);
+  // Non-virtual iterations keep the repaired netlist, so they always run
+  // the full repair_design pass.
+  const bool incremental = incremental_move_threshold_ >= 0
+                           && run_journal_restore && !gcell_locations_.empty();
+  std::vector<size_t> moved_gcells;
+  if (incremental) {
+    const std::vector<odb::dbNet*> moved_nets = findMovedNets(moved_gcells);
+    log_->info(GPL,
+               103,
+               "Timing-driven: incremental update of {} of {} nets.",
+               moved_nets.size(),
+               nbc_->getGNets().size());
+    rs_->updateResizeSlacks(moved_nets);
+  } else {
+    rs_->findResizeSlacks(run_journal_restore);
+  }
 
   if (!run_journal_restore) {
     nbc_->fixPointers();
   }
 
+  if (incremental) {
+    saveGCellLocations(moved_gcells);
+  } else if (incremental_move_threshold_ >= 0) {
+    saveGCellLocations();
+  }
+
   // get worst resize nets
   sta::NetSeq worst_slack_nets = rs_->resizeWorstSlackNets();
 
@@ -7,8 +7,13 @@
 #include <memory>
 #include <vector>
 
+#include "odb/geom.h"
 #include "rsz/Resizer.hh"
 
+namespace odb {
+class dbNet;
+}
+
 namespace rsz {
 class Resizer;
 }
@@ -40,6 +45,12 @@ class TimingBase
 
   void setTimingNetWeightMax(float max);
 
+  // When non-negative, virtual timing-driven iterations after the first
+  // one keep the resizer's parasitics and timing, and only re-estimate
+  // nets with a cell that moved more than threshold DBU since its nets
+  // were last estimated.
+  void setIncrementalMoveThreshold(int threshold);
+
   // updateNetWeight.
   // True: successfully reweighted gnets
   // False: no slacks found
@@ -53,7 +64,16 @@ class TimingBase
   std::vector<int> timingNetWeightOverflow_;
   std::vector<int> timingOverflowChk_;
   float net_weight_max_ = 5;
+  int incremental_move_threshold_ = -1;
+  // Cell centers at which the nets of each cell were last estimated,
+  // parallel to nbc_->getGCells().
+  std::vector<odb::Point> gcell_locations_;
+
   void initTimingOverflowChk();
+  std::vector<odb::dbNet*> findMovedNets(
+      std::vector<size_t>& moved_gcells) const;
+  void saveGCellLocations();
+  void saveGCellLocations(const std::vector<size_t>& gcells);
 };
 
 }  // namespace gpl
@@ -0,0 +1,25 @@
+# coarsen-place-uncoarsen with -cluster_gcells
+source helpers.tcl
+source placement_checks.tcl
+read_lef ./nangate45.lef
+read_def ./cluster_place01.def
+
+global_placement -density 0.6 -init_density_penalty 0.01 -cluster_gcells 100
+
+set block [ord::get_db_block]
+check_placed_in_core
+
+# Declustering must spread the members of each cluster, not leave them
+# stacked at the cluster's center.
+proc count_distinct_locations { block } {
+  set locations {}
+  foreach inst [$block getInsts] {
+    dict set locations [$inst getOrigin] 1
+  }
+  return [dict size $locations]
+}
+check "instances at distinct locations" {
+  expr { [count_distinct_locations $block] > 0.9 * [llength [$block getInsts]] }
+} 1
+
+exit_summary
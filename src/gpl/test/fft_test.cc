@@ -1,11 +1,15 @@
 #include "src/gpl/src/fft.h"
 
+#include <cmath>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "spdlog/fmt/fmt.h"
+#include "src/gpl/src/dct.h"
 
 namespace {
 
@@ -146,4 +150,104 @@ TEST(FloatFFTTest, Basic)
   }
 }
 
+// Direct evaluation of the sums documented in dct.h.
+std::vector<double> referenceTransform(gpl::DctType type,
+                                       const std::vector<float>& a)
+{
+  const int n = a.size();
+  std::vector<double> out(n, 0);
+  for (int k = 0; k < n; k++) {
+    for (int j = 0; j < n; j++) {
+      switch (type) {
+        case gpl::DctType::kDct:
+          out[k] += a[j] * std::cos(M_PI * (j + 0.5) * k / n);
+          break;
+        case gpl::DctType::kIdct:
+          out[k] += a[j] * std::cos(M_PI * j * (k + 0.5) / n);
+          break;
+        case gpl::DctType::kIdst:
+          out[k] += a[j] * std::sin(M_PI * (j == 0 ? n : j) * (k + 0.5) / n);
+          break;
+      }
+    }
+  }
+  return out;
+}
+
+std::vector<float> randomValues(int n)
+{
+  std::mt19937 rng(n);
+  std::uniform_real_distribution<float> value(-1, 1);
+  std::vector<float> a(n);
+  for (float& v : a) {
+    v = value(rng);
+  }
+  return a;
+}
+
+TEST(DctTest, MixedRadixMatchesDefinition)
+{
+  for (int n : {1, 2, 3, 5, 6, 12, 15, 28, 49, 60, 64, 97}) {
+    SCOPED_TRACE(n);
+    auto engine = gpl::DctEngine::createMixedRadix(n, n);
+    gpl::DctWork work;
+    for (gpl::DctType type :
+         {gpl::DctType::kDct, gpl::DctType::kIdct, gpl::DctType::kIdst}) {
+      std::vector<float> a = randomValues(n);
+      const std::vector<double> expected = referenceTransform(type, a);
+      engine->transform(type, n, a.data(), work);
+      for (int k = 0; k < n; k++) {
+        EXPECT_NEAR(a[k], expected[k], 1e-4 * n);
+      }
+    }
+  }
+}
+
+TEST(DctTest, OouraMatchesDefinition)
+{
+  auto engine = gpl::DctEngine::create(16, 64);
+  gpl::DctWork work;
+  for (int n : {16, 64}) {
+    SCOPED_TRACE(n);
+    for (gpl::DctType type :
+         {gpl::DctType::kDct, gpl::DctType::kIdct, gpl::DctType::kIdst}) {
+      std::vector<float> a = randomValues(n);
+      const std::vector<double> expected = referenceTransform(type, a);
+      engine->transform(type, n, a.data(), work);
+      for (int k = 0; k < n; k++) {
+        EXPECT_NEAR(a[k], expected[k], 1e-4 * n);
+      }
+    }
+  }
+}
+
+TEST(FloatFFTTest, ThreadsAndNonPowerOfTwo)
+{
+  for (auto [x_max, y_max] : {std::pair{32, 16}, std::pair{24, 20}}) {
+    SCOPED_TRACE(fmt::format("{}x{}", x_max, y_max));
+    gpl::FFT serial(x_max, y_max, 1, 2);
+    gpl::FFT threaded(x_max, y_max, 1, 2, 4);
+    const std::vector<float> density = randomValues(x_max * y_max);
+    for (int x = 0; x < x_max; x++) {
+      for (int y = 0; y < y_max; y++) {
+        serial.updateDensity(x, y, density[x * y_max + y]);
+        threaded.updateDensity(x, y, density[x * y_max + y]);
+      }
+    }
+    serial.doFFT();
+    threaded.doFFT();
+
+    double phi_sum = 0;
+    for (int x = 0; x < x_max; x++) {
+      for (int y = 0; y < y_max; y++) {
+        EXPECT_EQ(serial.getElectroForce(x, y), threaded.getElectroForce(x, y));
+        EXPECT_EQ(serial.getElectroPhi(x, y), threaded.getElectroPhi(x, y));
+        phi_sum += serial.getElectroPhi(x, y);
+      }
+    }
+    // The DC term is dropped, so the potential has zero mean.
+    EXPECT_NEAR(phi_sum, 0, 1e-3);
+  }
+}
+
 }  // namespace
@@ -0,0 +1,31 @@
+# warm start with an explicit -incremental_window: the unplaced instances
+# must end up inside the window
+source helpers.tcl
+source placement_checks.tcl
+read_lef ./nangate45.lef
+read_def ./incremental01.def
+
+set block [ord::get_db_block]
+set window {10 10 20 20}
+
+# unplace a few instances and leave them in the corner, away from the window
+set unplaced [lrange [$block getInsts] 0 9]
+foreach inst $unplaced {
+  $inst setLocation 0 0
+  $inst setPlacementStatus NONE
+}
+
+global_placement -init_density_penalty 0.1 -incremental \
+  -incremental_window $window
+
+# the window is snapped outwards to the rows and sites
+set tolerance [ord::microns_to_dbu 1.4]
+lassign [lmap coord $window { ord::microns_to_dbu $coord }] lx ly ux uy
+check "unplaced instances placed inside the window" {
+  count_insts_outside $unplaced [expr { $lx - $tolerance }] \
+    [expr { $ly - $tolerance }] [expr { $ux + $tolerance }] \
+    [expr { $uy + $tolerance }]
+} 0
+check_placed_in_core
+
+exit_summary
@@ -0,0 +1,22 @@
+# initial placement with the PCG solver lands close to the BiCGSTAB one
+source helpers.tcl
+source placement_checks.tcl
+read_lef ./nangate45.lef
+read_def ./simple01.def
+
+# report_hpwl.tcl sources helpers.tcl, so it runs before any check.
+utl::redirectStringBegin
+global_placement -skip_nesterov_place
+source report_hpwl.tcl
+set bicgstab_hpwl $total_hpwl
+
+global_placement -skip_nesterov_place -initial_place_pcg
+source report_hpwl.tcl
+set pcg_hpwl $total_hpwl
+utl::redirectStringEnd
+
+check_placed_in_core
+check "PCG HPWL within 5% of BiCGSTAB" \
+  { expr { abs($pcg_hpwl - $bicgstab_hpwl) <= 0.05 * $bicgstab_hpwl } } 1
+
+exit_summary
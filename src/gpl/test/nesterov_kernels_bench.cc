@@ -0,0 +1,114 @@
+// Micro-benchmark of the Nesterov kernels at each SIMD level.
+//
+// usage: nesterov_kernels_bench [num_pins] [iterations]
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "src/gpl/src/nesterovKernels.h"
+
+namespace {
+
+using gpl::SimdLevel;
+
+double nsPerIteration(int iterations, const std::function<void()>& kernel)
+{
+  kernel();  // warm up
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    kernel();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count()
+         / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const int num_pins = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 20;
+  // Typical nets have a handful of pins.
+  const int num_nets = num_pins / 4;
+  constexpr int num_bins = 64;
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> coord(0, 1000000);
+  std::vector<int> x(num_pins), y(num_pins), net(num_pins);
+  for (int i = 0; i < num_pins; i++) {
+    x[i] = coord(rng);
+    y[i] = coord(rng);
+    net[i] = i / 4;
+  }
+  std::vector<int> lx(num_nets), ly(num_nets), ux(num_nets), uy(num_nets);
+  std::vector<float> min_x(num_pins), max_x(num_pins);
+  std::vector<float> min_y(num_pins), max_y(num_pins);
+  std::vector<int> bin_lo(num_bins), bin_hi(num_bins);
+  for (int i = 0; i < num_bins; i++) {
+    bin_lo[i] = i * 1000;
+    bin_hi[i] = (i + 1) * 1000;
+  }
+  std::vector<float> length(num_bins);
+
+  std::printf("%-8s %16s %16s %16s\n",
+              "level",
+              "box ns/iter",
+              "wa exp ns/iter",
+              "overlap ns/iter");
+  for (SimdLevel level :
+       {SimdLevel::kScalar, SimdLevel::kAvx2, SimdLevel::kAvx512}) {
+    if (level > gpl::getMaxSimdLevel()) {
+      continue;
+    }
+    gpl::setSimdLevel(level);
+
+    const double box_ns = nsPerIteration(iterations, [&] {
+      for (int n = 0; n < num_nets; n++) {
+        gpl::getPinBox(
+            &x[n * 4], &y[n * 4], 4, lx[n], ly[n], ux[n], uy[n]);
+      }
+    });
+
+    gpl::WaExpInput in;
+    in.n = num_pins;
+    in.x = x.data();
+    in.y = y.data();
+    in.net = net.data();
+    in.net_lx = lx.data();
+    in.net_ly = ly.data();
+    in.net_ux = ux.data();
+    in.net_uy = uy.data();
+    in.coeff_x = 1.0f / 3000;
+    in.coeff_y = 1.0f / 3000;
+    in.min_exp = -300;
+    const double exp_ns = nsPerIteration(iterations, [&] {
+      gpl::computeWaExp(
+          in, {min_x.data(), max_x.data(), min_y.data(), max_y.data()});
+    });
+
+    // One call per cell spanning every column.
+    const double overlap_ns = nsPerIteration(iterations, [&] {
+      for (int i = 0; i < num_nets; i++) {
+        gpl::getOverlapLengths(x[i] / 16,
+                               x[i] / 16 + 20000,
+                               bin_lo.data(),
+                               bin_hi.data(),
+                               num_bins,
+                               length.data());
+      }
+    });
+
+    std::printf("%-8s %16.0f %16.0f %16.0f\n",
+                gpl::getSimdLevelName(level),
+                box_ns,
+                exp_ns,
+                overlap_ns);
+  }
+  return 0;
+}
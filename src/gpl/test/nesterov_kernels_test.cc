@@ -0,0 +1,153 @@
+#include "src/gpl/src/nesterovKernels.h"
+
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace gpl {
+namespace {
+
+std::vector<SimdLevel> supportedLevels()
+{
+  std::vector<SimdLevel> levels;
+  for (SimdLevel level :
+       {SimdLevel::kScalar, SimdLevel::kAvx2, SimdLevel::kAvx512}) {
+    if (level <= getMaxSimdLevel()) {
+      levels.push_back(level);
+    }
+  }
+  return levels;
+}
+
+class NesterovKernelsTest : public ::testing::Test
+{
+ protected:
+  void TearDown() override { setSimdLevel(getMaxSimdLevel()); }
+};
+
+TEST_F(NesterovKernelsTest, FastExpMatchesExp)
+{
+  EXPECT_FLOAT_EQ(fastExp(0), 1);
+  EXPECT_NEAR(fastExp(-1), 0.3677, 1e-3);
+  EXPECT_NEAR(fastExp(-10), 4.31e-5, 1e-6);
+}
+
+TEST_F(NesterovKernelsTest, PinBox)
+{
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> coord(-100000, 100000);
+  std::vector<int> x(37);
+  std::vector<int> y(37);
+  for (size_t i = 0; i < x.size(); i++) {
+    x[i] = coord(rng);
+    y[i] = coord(rng);
+  }
+
+  for (SimdLevel level : supportedLevels()) {
+    setSimdLevel(level);
+    SCOPED_TRACE(getSimdLevelName(level));
+    for (int n : {0, 1, 7, 8, 16, 37}) {
+      int lx, ly, ux, uy;
+      getPinBox(x.data(), y.data(), n, lx, ly, ux, uy);
+      int elx = INT_MAX, ely = INT_MAX, eux = INT_MIN, euy = INT_MIN;
+      for (int i = 0; i < n; i++) {
+        elx = std::min(elx, x[i]);
+        ely = std::min(ely, y[i]);
+        eux = std::max(eux, x[i]);
+        euy = std::max(euy, y[i]);
+      }
+      EXPECT_EQ(lx, elx);
+      EXPECT_EQ(ly, ely);
+      EXPECT_EQ(ux, eux);
+      EXPECT_EQ(uy, euy);
+    }
+  }
+}
+
+TEST_F(NesterovKernelsTest, WaExpIsIdenticalAtEveryLevel)
+{
+  constexpr int num_nets = 50;
+  constexpr int num_pins = 203;
+  std::mt19937 rng(2);
+  std::uniform_int_distribution<int> coord(0, 200000);
+  std::uniform_int_distribution<int> pick_net(0, num_nets - 1);
+
+  std::vector<int> x(num_pins), y(num_pins), net(num_pins);
+  for (int i = 0; i < num_pins; i++) {
+    x[i] = coord(rng);
+    y[i] = coord(rng);
+    net[i] = pick_net(rng);
+  }
+  std::vector<int> lx(num_nets, INT_MAX), ly(num_nets, INT_MAX);
+  std::vector<int> ux(num_nets, INT_MIN), uy(num_nets, INT_MIN);
+  for (int i = 0; i < num_pins; i++) {
+    lx[net[i]] = std::min(lx[net[i]], x[i]);
+    ly[net[i]] = std::min(ly[net[i]], y[i]);
+    ux[net[i]] = std::max(ux[net[i]], x[i]);
+    uy[net[i]] = std::max(uy[net[i]], y[i]);
+  }
+
+  WaExpInput in;
+  in.n = num_pins;
+  in.x = x.data();
+  in.y = y.data();
+  in.net = net.data();
+  in.net_lx = lx.data();
+  in.net_ly = ly.data();
+  in.net_ux = ux.data();
+  in.net_uy = uy.data();
+  in.coeff_x = 1.0f / 3000;
+  in.coeff_y = 1.0f / 5000;
+  in.min_exp = -30;
+
+  std::vector<std::vector<float>> expected;
+  for (SimdLevel level : supportedLevels()) {
+    setSimdLevel(level);
+    SCOPED_TRACE(getSimdLevelName(level));
+    std::vector<std::vector<float>> terms(4, std::vector<float>(num_pins));
+    computeWaExp(in,
+                 {terms[0].data(),
+                  terms[1].data(),
+                  terms[2].data(),
+                  terms[3].data()});
+    if (expected.empty()) {
+      expected = terms;
+      // Spot check the scalar results against the definition.
+      for (int i = 0; i < num_pins; i++) {
+        const float exp = (lx[net[i]] - x[i]) * in.coeff_x;
+        EXPECT_EQ(terms[0][i], exp > in.min_exp ? fastExp(exp) : 0);
+      }
+    } else {
+      EXPECT_EQ(terms, expected);
+    }
+  }
+}
+
+TEST_F(NesterovKernelsTest, OverlapLengths)
+{
+  constexpr int num_bins = 21;
+  std::vector<int> bin_lo(num_bins), bin_hi(num_bins);
+  for (int i = 0; i < num_bins; i++) {
+    bin_lo[i] = i * 100;
+    bin_hi[i] = (i + 1) * 100;
+  }
+
+  for (SimdLevel level : supportedLevels()) {
+    setSimdLevel(level);
+    SCOPED_TRACE(getSimdLevelName(level));
+    std::vector<float> length(num_bins);
+    getOverlapLengths(
+        250, 1730, bin_lo.data(), bin_hi.data(), num_bins, length.data());
+    for (int i = 0; i < num_bins; i++) {
+      const int overlap
+          = std::min(1730, bin_hi[i]) - std::max(250, bin_lo[i]);
+      EXPECT_EQ(length[i], std::max(overlap, 0));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace gpl
@@ -0,0 +1,27 @@
+# Placement checks shared by the gpl pass/fail tests.  Source after
+# helpers.tcl, which provides check.
+
+# Number of insts that are not placed or not inside lx ly ux uy (DBU).
+proc count_insts_outside { insts lx ly ux uy } {
+  set count 0
+  foreach inst $insts {
+    set bbox [$inst getBBox]
+    if {
+      [$inst getPlacementStatus] != "PLACED"
+      || [$bbox xMin] < $lx || [$bbox xMax] > $ux
+      || [$bbox yMin] < $ly || [$bbox yMax] > $uy
+    } {
+      incr count
+    }
+  }
+  return $count
+}
+
+proc check_placed_in_core { } {
+  set block [ord::get_db_block]
+  set core [$block getCoreArea]
+  check "instances placed inside the core" {
+    count_insts_outside [$block getInsts] \
+      [$core xMin] [$core yMin] [$core xMax] [$core yMax]
+  } 0
+}
@@ -0,0 +1,40 @@
+# timing-driven with incremental re-estimation of the moved nets
+source helpers.tcl
+source placement_checks.tcl
+set test_name simple01-td
+read_liberty ./library/nangate45/NangateOpenCellLibrary_typical.lib
+
+read_lef ./nangate45.lef
+read_def ./$test_name.def
+
+create_clock -name core_clock -period 2 clk
+
+set_wire_rc -signal -layer metal3
+set_wire_rc -clock  -layer metal5
+
+utl::redirectStringBegin
+global_placement -timing_driven -timing_driven_incremental_threshold 1
+set log [utl::redirectStringEnd]
+
+set updates [regexp -all -inline \
+  {incremental update of (\d+) of (\d+) nets} $log]
+check "incremental timing updates ran" { expr { [llength $updates] > 0 } } 1
+
+proc count_bad_updates { updates } {
+  set count 0
+  foreach { - moved total } $updates {
+    if { $moved > $total } {
+      incr count
+    }
+  }
+  return $count
+}
+check "updates count at most every net" { count_bad_updates $updates } 0
+
+check_placed_in_core
+
+# check reported wns
+estimate_parasitics -placement
+report_worst_slack
+
+exit_summary
@@ -0,0 +1,37 @@
+# routability-driven with incremental global routing for the congestion
+source helpers.tcl
+source placement_checks.tcl
+read_liberty ./library/nangate45/NangateOpenCellLibrary_typical.lib
+
+read_lef ./nangate45.lef
+read_def ./simple02-rd.def
+
+set_debug_level GPL incremental_grt 1
+utl::redirectStringBegin
+global_placement -routability_driven -routability_incremental_grt \
+  -routability_target_rc_metric 1.0
+set log [utl::redirectStringEnd]
+set_debug_level GPL incremental_grt 0
+
+# after the first full route, each round reroutes only the dirty nets
+set rounds [regexp -all -inline \
+  {Incremental global route of (\d+) of (\d+) nets} $log]
+check "incremental global routes ran" { expr { [llength $rounds] > 0 } } 1
+
+proc count_full_reroutes { rounds } {
+  set count 0
+  foreach { - dirty total } $rounds {
+    if { $dirty >= $total } {
+      incr count
+    }
+  }
+  return $count
+}
+check "only dirty nets rerouted" { count_full_reroutes $rounds } 0
+
+check_placed_in_core
+
+# the incremental routing session must be closed when placement ends
+check "global route after placement" { catch { global_route } } 0
+
+exit_summary
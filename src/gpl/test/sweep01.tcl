@@ -0,0 +1,36 @@
+# multi-start Nesterov sweep over target densities and overflows
+source helpers.tcl
+source placement_checks.tcl
+read_lef ./nangate45.lef
+read_def ./simple01.def
+
+utl::redirectStringBegin
+set results [global_placement -init_density_penalty 0.01 -skip_initial_place \
+  -sweep_densities {0.6 0.8} -sweep_overflows {0.1 0.2}]
+set log [utl::redirectStringEnd]
+
+check "a sweep run is written to the db" \
+  { regexp {Writing sweep run \d+ to the db} $log } 1
+check "one result per run" { llength $results } 4
+check "run 3 settings" \
+  { format "%.1f %.1f" [dict get [lindex $results 3] density] \
+      [dict get [lindex $results 3] target_overflow] } "0.8 0.2"
+check "run 0 reports HPWL" { expr { [dict get [lindex $results 0] hpwl] > 0 } } 1
+check "iteration reports are not interleaved" \
+  { regexp {Sweep run 0:\nIteration[^\n]*\n-+\n(\s+\d+ \|[^\n]*\n)+Sweep run 1:} \
+      $log } 1
+
+check_placed_in_core
+
+check "density above 1 is rejected" \
+  { catch { global_placement -sweep_densities {0.7 1.5} } } 1
+check "overflow above 1 is rejected" \
+  { catch { global_placement -sweep_overflows {2} } } 1
+
+utl::redirectStringBegin
+global_placement -init_density_penalty 0.01 -skip_initial_place \
+  -routability_driven -sweep_densities {0.7}
+set log [utl::redirectStringEnd]
+check "routability-driven sweep warns" { regexp {GPL-0129} $log } 1
+
+exit_summary
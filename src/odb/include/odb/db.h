@@ -36,6 +36,8 @@ class Logger;
 namespace odb {
 
 class dbShape;
+struct dbWireShapes;
+class dbShapeIndex;
 class lefout;
 class dbViaParams;
 class dbTransform;
@@ -379,15 +381,21 @@ class dbDatabase : public dbObject
   ///
   /// Read a database from this stream.
   /// WARNING: This function destroys the data currently in the database.
+  /// The framed object tables of each block are read on up to num_threads
+  /// threads.
   /// Throws ZIOError..
   ///
-  void read(std::istream& f);
+  void read(std::istream& f, int num_threads = 1);
 
   ///
   /// Write a database to this stream.
+  /// The object tables of each block are written as separate frames, on up
+  /// to num_threads threads, and compressed with zlib if compress_tables.
   /// Throws ZIOError..
   ///
-  void write(std::ostream& file);
+  void write(std::ostream& file,
+             int num_threads = 1,
+             bool compress_tables = false);
 
   ///
   /// ECO - The following methods implement a simple ECO mechanism for capturing
@@ -443,6 +451,24 @@ class dbDatabase : public dbObject
   ///
   static void undoEco(dbBlock* block);
 
+  ///
+  /// Incremental checkpoints.  beginCheckpoint starts recording every
+  /// journaled change of the block, including the changes of ecos that are
+  /// not undone.  writeCheckpoint writes what was recorded since then and
+  /// readCheckpoint replays such a file onto the block loaded from the same
+  /// base database.  Only the changes the eco journal supports are
+  /// captured (netlist edits, placement and master swaps; not routing).
+  ///
+  static void beginCheckpoint(dbBlock* block);
+  static void endCheckpoint(dbBlock* block);
+
+  ///
+  /// Returns true if a checkpoint is being recorded and is still complete.
+  ///
+  static bool hasCheckpoint(dbBlock* block);
+  static void writeCheckpoint(dbBlock* block, std::ostream& file);
+  static void readCheckpoint(dbBlock* block, std::istream& file);
+
   ///
   /// links to utl::Logger
   ///
@@ -1118,6 +1144,13 @@ class dbBlock : public dbObject
   ///
   dbInst* findInst(const char* name);
 
+  ///
+  /// Allocate the instance table and size the instance name table for
+  /// num_insts more instances so that creating many instances (eg reading
+  /// DEF) doesn't grow them repeatedly.
+  ///
+  void reserveInsts(uint num_insts);
+
   ///
   /// Find a specific module in this block.
   /// Returns nullptr if the object was not found.
@@ -1209,6 +1242,32 @@ class dbBlock : public dbObject
   ///
   dbNet* findNet(const char* name);
 
+  ///
+  /// Allocate the net table and size the net name table for num_nets more
+  /// nets.
+  ///
+  void reserveNets(uint num_nets);
+
+  ///
+  /// Get the shapes of all net wires as flat arrays, decoding wires with
+  /// num_threads threads. The snapshot is cached until a wire is created,
+  /// destroyed or modified. Not thread safe.
+  ///
+  const dbWireShapes& getWireShapes(int num_threads = 1);
+
+  ///
+  /// Get the spatial index of this block's wires, special wires,
+  /// obstructions and instances. It is built with num_threads threads on
+  /// first use and then kept up to date as the block changes.
+  ///
+  const dbShapeIndex* getShapeIndex(int num_threads = 1);
+
+  ///
+  /// Free the shape index and stop maintaining it. Pointers returned by
+  /// getShapeIndex become invalid; the next call builds a new index.
+  ///
+  void releaseShapeIndex();
+
   //
   // Utility to write db file
   //
@@ -2705,6 +2764,15 @@ class dbNet : public dbObject
                        const char* name,
                        bool skipExistingCheck = false);
 
+  ///
+  /// Create a net for each name, in order. The tables are sized once up
+  /// front and callbacks get a single inDbNetsCreate. The entry for a name
+  /// that already exists is nullptr.
+  ///
+  static std::vector<dbNet*> create(dbBlock* block,
+                                    const std::vector<std::string>& names,
+                                    bool skipExistingCheck = false);
+
   ///
   /// Delete this net from this block.
   ///
@@ -3275,6 +3343,17 @@ class dbInst : public dbObject
                         bool physical_only = false,
                         dbModule* parent_module = nullptr);
 
+  ///
+  /// Create an instance of master for each name, in order. The tables are
+  /// sized once up front and callbacks get a single inDbInstsCreate. The
+  /// entry for a name that already exists is nullptr.
+  ///
+  static std::vector<dbInst*> create(dbBlock* block,
+                                     dbMaster* master,
+                                     const std::vector<std::string>& names,
+                                     bool physical_only = false,
+                                     dbModule* parent_module = nullptr);
+
   static dbInst* makeUniqueDbInst(dbBlock* block,
                                   dbMaster* master,
                                   const char* name,
@@ -5938,6 +6017,12 @@ class dbTech : public dbObject
   ///
   dbSet<dbTechLayer> getLayers();
 
+  ///
+  /// Write the technology alone, as it is stored in a database file.
+  /// Any change to the layers, vias or rules changes the bytes written.
+  ///
+  void write(std::ostream& file);
+
   ///
   /// Find the technology layer.
   /// Returns nullptr if the object was not found.
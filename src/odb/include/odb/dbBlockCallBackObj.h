@@ -4,6 +4,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "odb.h"
 
@@ -46,6 +47,9 @@ class dbBlockCallBackObj
   // dbInst Start
   virtual void inDbInstCreate(dbInst*) {}
   virtual void inDbInstCreate(dbInst*, dbRegion*) {}
+  // Bulk dbInst::create; by default calls inDbInstCreate and then
+  // inDbITermCreate for the iterms of each instance.
+  virtual void inDbInstsCreate(const std::vector<dbInst*>& insts);
   virtual void inDbInstDestroy(dbInst*) {}
   virtual void inDbInstPlacementStatusBefore(dbInst*, const dbPlacementStatus&)
   {
@@ -58,6 +62,8 @@ class dbBlockCallBackObj
 
   // dbNet Start
   virtual void inDbNetCreate(dbNet*) {}
+  // Bulk dbNet::create; by default calls inDbNetCreate for each net.
+  virtual void inDbNetsCreate(const std::vector<dbNet*>& nets);
   virtual void inDbNetDestroy(dbNet*) {}
   virtual void inDbNetPreMerge(dbNet*, dbNet*) {}
   // dbNet End
@@ -278,6 +278,37 @@ class dbWireShapeItr
   int getShapeId();
 };
 
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbWireShapes - Struct-of-arrays snapshot of the wire shapes of a block
+/// (see dbBlock::getWireShapes). Vias are expanded into their boxes.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct dbWireShapes
+{
+  std::vector<int> layer;         // dbTechLayer number
+  std::vector<int> xlo;
+  std::vector<int> ylo;
+  std::vector<int> xhi;
+  std::vector<int> yhi;
+  std::vector<uint> net_id;       // dbNet id
+  std::vector<uint> via_id;       // dbVia id of a via box, otherwise 0
+  std::vector<uint> tech_via_id;  // dbTechVia id of a via box, otherwise 0
+
+  size_t size() const { return net_id.size(); }
+  void resize(size_t n)
+  {
+    layer.resize(n);
+    xlo.resize(n);
+    ylo.resize(n);
+    xhi.resize(n);
+    yhi.resize(n);
+    net_id.resize(n);
+    via_id.resize(n);
+    tech_via_id.resize(n);
+  }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 ///
 /// dbWirePathItr - Iterate the paths of a dbWire.
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#pragma once
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "odb/dbBlockCallBackObj.h"
+#include "odb/geom.h"
+#include "odb/geom_boost.h"
+
+namespace odb {
+
+class dbBlock;
+class dbInst;
+class dbNet;
+class dbObstruction;
+class dbRegion;
+class dbSBox;
+class dbSWire;
+class dbTechLayer;
+class dbWire;
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbShapeIndex - Per-layer rtrees over the routing and placement shapes of
+/// a block (see dbBlock::getShapeIndex).
+///
+/// The index is kept up to date through dbBlockCallBackObj as the block is
+/// edited. The find methods are const and may be called from several threads
+/// at once as long as the block is not modified at the same time.
+///
+///////////////////////////////////////////////////////////////////////////////
+class dbShapeIndex : public dbBlockCallBackObj
+{
+ public:
+  template <typename T>
+  using RectValue = std::pair<Rect, T>;
+  template <typename T>
+  using Rtree
+      = boost::geometry::index::rtree<RectValue<T>,
+                                      boost::geometry::index::quadratic<16>>;
+
+  dbShapeIndex(dbBlock* block, int num_threads);
+
+  ///
+  /// Append the dbWire shapes on layer overlapping rect to shapes.
+  ///
+  void findWires(dbTechLayer* layer,
+                 const Rect& rect,
+                 std::vector<RectValue<dbNet*>>& shapes) const;
+
+  ///
+  /// Append the special wire boxes on layer overlapping rect to shapes.
+  /// Special vias are split into their per-layer boxes.
+  ///
+  void findSpecialWires(dbTechLayer* layer,
+                        const Rect& rect,
+                        std::vector<RectValue<dbSBox*>>& shapes) const;
+
+  ///
+  /// Append the obstructions on layer overlapping rect to shapes.
+  ///
+  void findObstructions(dbTechLayer* layer,
+                        const Rect& rect,
+                        std::vector<RectValue<dbObstruction*>>& shapes) const;
+
+  ///
+  /// Append the instances whose bounding box overlaps rect to insts.
+  ///
+  void findInsts(const Rect& rect,
+                 std::vector<RectValue<dbInst*>>& insts) const;
+
+  // dbBlockCallBackObj
+  void inDbInstCreate(dbInst* inst) override;
+  void inDbInstCreate(dbInst* inst, dbRegion* region) override;
+  void inDbInstDestroy(dbInst* inst) override;
+  void inDbInstSwapMasterBefore(dbInst* inst, dbMaster* master) override;
+  void inDbInstSwapMasterAfter(dbInst* inst) override;
+  void inDbPreMoveInst(dbInst* inst) override;
+  void inDbPostMoveInst(dbInst* inst) override;
+  void inDbNetDestroy(dbNet* net) override;
+  void inDbObstructionCreate(dbObstruction* obs) override;
+  void inDbObstructionDestroy(dbObstruction* obs) override;
+  void inDbWireDestroy(dbWire* wire) override;
+  void inDbWirePostModify(dbWire* wire) override;
+  void inDbWirePreAttach(dbWire* wire, dbNet* net) override;
+  void inDbWirePostAttach(dbWire* wire) override;
+  void inDbWirePreDetach(dbWire* wire) override;
+  void inDbWirePostAppend(dbWire* src, dbWire* dst) override;
+  void inDbWirePostCopy(dbWire* src, dbWire* dst) override;
+  void inDbSWireAddSBox(dbSBox* sbox) override;
+  void inDbSWireRemoveSBox(dbSBox* sbox) override;
+  void inDbSWirePreDestroySBoxes(dbSWire* swire) override;
+
+ private:
+  struct Layer
+  {
+    Rtree<dbNet*> wires;
+    Rtree<dbSBox*> swires;
+    Rtree<dbObstruction*> obstructions;
+  };
+
+  using LayerShapes = std::vector<std::pair<dbTechLayer*, Rect>>;
+
+  void build(int num_threads);
+  const Layer* findLayer(dbTechLayer* layer) const;
+  static void getWireShapes(dbWire* wire, LayerShapes& shapes);
+  static void getSBoxShapes(dbSBox* sbox, LayerShapes& shapes);
+  void insertWire(dbNet* net);
+  void removeWire(dbNet* net);
+  void insertSBox(dbSBox* sbox);
+  void removeSBox(dbSBox* sbox);
+  void insertInst(dbInst* inst);
+  void removeInst(dbInst* inst);
+
+  dbBlock* block_;
+  std::unordered_map<dbTechLayer*, Layer> layers_;
+  Rtree<dbInst*> insts_;
+  // Shapes as inserted, so they can be removed after the db has changed.
+  std::unordered_map<dbNet*, LayerShapes> net_wire_shapes_;
+  std::unordered_map<dbInst*, Rect> inst_boxes_;
+};
+
+}  // namespace odb
@@ -7,6 +7,7 @@
 #include <boost/container/flat_map.hpp>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <istream>
 #include <map>
 #include <ostream>
@@ -41,6 +42,8 @@ class dbOStream
   double _lef_area_factor;
   double _lef_dist_factor;
   std::vector<Scope> _scopes;
+  int _num_threads = 1;
+  bool _compress_tables = false;
 
   // By default values are written as their string ("255" vs 0xFF)
   // representations when using the << stream method. In dbOstream we are
@@ -52,7 +55,12 @@ class dbOStream
   }
 
  public:
+  using TableWriter = std::function<void(dbOStream&)>;
+
   dbOStream(_dbDatabase* db, std::ostream& f);
+  // A stream for one table frame of parent; it shares the parent's
+  // settings and scope names.
+  dbOStream(const dbOStream& parent, std::ostream& f);
 
   _dbDatabase* getDatabase() { return _db; }
 
@@ -257,6 +265,20 @@ class dbOStream
 
   void pushScope(const std::string& name);
   void popScope();
+
+  // Number of threads independent tables may be serialized on.
+  int getNumThreads() const { return _num_threads; }
+  void setNumThreads(int num_threads) { _num_threads = num_threads; }
+
+  // Compress each table frame with zlib.
+  bool getCompressTables() const { return _compress_tables; }
+  void setCompressTables(bool compress) { _compress_tables = compress; }
+
+  // Writes each table as a frame (see db_schema_block_table_frames), the
+  // tables on up to getNumThreads() threads.  The frames are written in
+  // order as they complete, so at most one table per thread is held in
+  // memory.
+  void writeTableFrames(const std::vector<TableWriter>& writers);
 };
 
 // RAII class for scoping ostream operations
@@ -280,12 +302,27 @@ class dbIStream
   _dbDatabase* _db;
   double _lef_area_factor;
   double _lef_dist_factor;
+  int _num_threads = 1;
 
  public:
+  using TableReader = std::function<void(dbIStream&)>;
+
   dbIStream(_dbDatabase* db, std::istream& f);
+  // A stream for one table frame of parent.
+  dbIStream(const dbIStream& parent, std::istream& f);
 
   _dbDatabase* getDatabase() { return _db; }
 
+  // Number of threads independent tables may be deserialized on.
+  int getNumThreads() const { return _num_threads; }
+  void setNumThreads(int num_threads) { _num_threads = num_threads; }
+
+  // Reads the frames written by dbOStream::writeTableFrames.  Each group
+  // reads its frames in order on one thread, so tables whose readers
+  // depend on one another must share a group; the groups are read on up
+  // to getNumThreads() threads.
+  void readTableFrames(const std::vector<std::vector<TableReader>>& groups);
+
   dbIStream& operator>>(bool& c)
   {
     unsigned char b;
@@ -36,6 +36,8 @@ class defout
   void setUseMasterIds(bool value);
   void selectNet(dbNet* net);
   void setVersion(Version v);  // default is 5.8
+  // Nets are formatted by this many threads; output order is unchanged.
+  void setNumThreads(int threads);
 
   bool writeBlock(dbBlock* block, const char* def_file);
 };
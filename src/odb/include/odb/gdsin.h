@@ -3,9 +3,9 @@
 
 #pragma once
 
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <set>
 #include <string>
 #include <vector>
@@ -23,13 +23,20 @@ class GDSReader
   /**
    * Reads a GDS file and returns a dbGDSLib object
    *
+   * The file is memory mapped. If a top cell is given, structures are first
+   * indexed by offset and only those reachable from the top cell are built.
+   *
    * @param filename The path to the GDS file
    * @param db The database to store the GDS data
+   * @param top_cell The structure to load with its hierarchy, or empty to
+   * load every structure
    * @return A dbGDSLib object containing the GDS data
    * @throws std::runtime_error if the file cannot be opened, or if the GDS is
    * corrupted
    */
-  dbGDSLib* read_gds(const std::string& filename, dbDatabase* db);
+  dbGDSLib* read_gds(const std::string& filename,
+                     dbDatabase* db,
+                     const std::string& top_cell = "");
 
  private:
   /**
@@ -56,6 +63,13 @@ class GDSReader
    */
   void checkRData(DataType eType, size_t eSize);
 
+  /**
+   * Copies size bytes at _pos from _file into dst and advances _pos
+   *
+   * Reading past the end zero fills dst and leaves _pos past the end.
+   */
+  void readBytes(void* dst, size_t size);
+
   /**
    * Reads a real8 from _file
    *
@@ -84,9 +98,20 @@ class GDSReader
    */
   bool readRecord();
 
+  /**
+   * Advances past the next record, decoding only its type and, for STRNAME
+   * and SNAME records, its name into data8
+   *
+   * @return true if a record was skipped, false at the end of the file
+   */
+  bool skipRecord(RecordType& type, std::string& data8);
+
   /** Parses a GDS Lib from the GDS file */
   bool processLib();
 
+  /** Parses the structures reachable from _top_cell from the GDS file */
+  bool processTopCell();
+
   /** Parses a GDS Structure from the GDS file */
   bool processStruct();
 
@@ -133,8 +158,12 @@ class GDSReader
    */
   dbGDSTextPres processTextPres();
 
-  /** Current filestream */
-  std::ifstream _file;
+  /** Memory mapped GDS file */
+  boost::iostreams::mapped_file_source _file;
+  /** Read position in _file */
+  size_t _pos = 0;
+  /** Structure whose hierarchy is loaded, or empty to load everything */
+  std::string _top_cell;
   /** Most recently read record */
   record_t _r;
   /** Current ODB Database */
@@ -4,7 +4,7 @@
 #pragma once
 
 #include <cstdint>
-#include <fstream>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -21,12 +21,18 @@ class GDSWriter
   /**
    * Writes a dbGDSLib object to a GDS file
    *
+   * Structures are encoded in parallel and written in library order. The
+   * output is gzip compressed if the filename ends in .gz.
+   *
    * @param filename The path to the output file
    * @param lib The dbGDSLib object to write
+   * @param num_threads The number of threads used to encode structures
    * @throws std::runtime_error if the file cannot be opened, or if the GDS is
    * corrupted
    */
-  void write_gds(dbGDSLib* lib, const std::string& filename);
+  void write_gds(dbGDSLib* lib,
+                 const std::string& filename,
+                 int num_threads = 1);
 
  private:
   /**
@@ -36,49 +42,57 @@ class GDSWriter
    */
   void calcRecSize(record_t& r);
 
+  /** Sets the BGNLIB/BGNSTR timestamp to the current time */
+  void setTimestamp();
+
   /**
-   * Writes a record to the output file stream
+   * Encodes a record into _buffer
    *
    * @param r The record to write
    */
   void writeRecord(record_t& r);
 
   /**
-   * Writes a real8 to _file
+   * Encodes a real8 into _buffer
    *
    * NOTE: real8 is not the same as double. This conversion is not lossless.
    */
   void writeReal8(double real);
 
-  /** Writes an int32 to _file */
+  /** Encodes an int32 into _buffer */
   void writeInt32(int32_t i);
 
-  /** Writes an int16 to _file */
+  /** Encodes an int16 into _buffer */
   void writeInt16(int16_t i);
 
-  /** Writes an int8 to _file */
+  /** Encodes an int8 into _buffer */
   void writeInt8(int8_t i);
 
-  /** Helper function to write layer record of a dbGDSElement to _file */
+  /** Helper function to write layer record of a dbGDSElement into _buffer */
   void writeLayer(int16_t layer);
-  /** Helper function to write XY record  of a dbGDSElement to _file */
+  /** Helper function to write XY record  of a dbGDSElement into _buffer */
   void writeXY(const std::vector<Point>& points);
-  /** Helper function to write the datatype record of a dbGDSElement to _file */
+  /** Helper function to write the datatype record of a dbGDSElement into _buffer */
   void writeDataType(int16_t data_type);
-  /** Helper function to end an element in _file */
+  /** Helper function to end an element in _buffer */
   void writeEndel();
 
-  /** Helper function a property attribute to _file */
+  /** Helper function a property attribute to _buffer */
   template <typename T>
   void writePropAttr(T* el);
 
-  /** Writes _lib to the _file */
-  void writeLib();
+  /** Writes _lib to out */
+  void writeLib(std::ostream& out, int num_threads);
+
+  /** Encodes structures in parallel and writes them to out in order */
+  void writeStructs(std::ostream& out,
+                    const std::vector<dbGDSStructure*>& structures,
+                    int num_threads);
 
-  /** Writes a dbGDSStructure to _file */
+  /** Encodes a dbGDSStructure into _buffer */
   void writeStruct(dbGDSStructure* str);
 
-  /** Writes different variants of dbGDSElement to _file */
+  /** Encodes different variants of dbGDSElement into _buffer */
   void writeBoundary(dbGDSBoundary* bnd);
   void writePath(dbGDSPath* path);
   void writeSRef(dbGDSSRef* sref);
@@ -86,14 +100,16 @@ class GDSWriter
   void writeText(dbGDSText* text);
   void writeBox(dbGDSBox* box);
 
-  /** Writes a Transform to _file */
+  /** Encodes a Transform into _buffer */
   void writeSTrans(const dbGDSSTrans& strans);
 
-  /** Writes a Text Presentation to _file */
+  /** Encodes a Text Presentation into _buffer */
   void writeTextPres(const dbGDSTextPres& pres);
 
-  /** Output filestream */
-  std::ofstream _file;
+  /** Output buffer for the records being encoded */
+  std::string* _buffer{nullptr};
+  /** BGNLIB/BGNSTR modification and access time */
+  std::vector<int16_t> _timestamp;
   /** Current dbGDSLib object */
   dbGDSLib* _lib{nullptr};
 
@@ -100,8 +100,10 @@
 #include "dbTrackGrid.h"
 #include "dbVia.h"
 #include "dbWire.h"
+#include "dbWireShapeCache.h"
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
+#include "odb/dbShapeIndex.h"
 #include "odb/dbExtControl.h"
 #include "odb/dbShape.h"
 #include "odb/defout.h"
@@ -404,6 +406,9 @@ _dbBlock::_dbBlock(_dbDatabase* db)
   _extmi = nullptr;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _checkpoint = nullptr;
+  _wire_shape_cache = nullptr;
+  _shape_index = nullptr;
 }
 
 _dbBlock::~_dbBlock()
@@ -497,6 +502,9 @@ _dbBlock::~_dbBlock()
   }
   delete _journal;
   delete _journal_pending;
+  delete _checkpoint;
+  delete _wire_shape_cache;
+  delete _shape_index;
 }
 
 void dbBlock::clear()
@@ -513,6 +521,13 @@ void dbBlock::clear()
   // save a copy of the delimiter
   char delimiter = block->_hier_delimiter;
 
+  // the wire shape cache and shape index are owned by the block, not client
+  // callbacks
+  delete block->_wire_shape_cache;
+  block->_wire_shape_cache = nullptr;
+  delete block->_shape_index;
+  block->_shape_index = nullptr;
+
   std::list<dbBlockCallBackObj*> callbacks;
 
   // save callbacks
@@ -794,61 +809,76 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << block._component_mask_shift;
   stream << block._currentCcAdjOrder;
 
-  stream << *block._bterm_tbl;
-  stream << *block._iterm_tbl;
-  stream << *block._net_tbl;
-  stream << *block._inst_hdr_tbl;
+  // The object tables are independent of one another so they are written
+  // as separate frames, which may be serialized concurrently.  The order
+  // must match the readers in operator>>.
+  std::vector<dbOStream::TableWriter> table_writers;
+  auto add_table = [&table_writers](const auto& table) {
+    table_writers.emplace_back([&table](dbOStream& s) { s << table; });
+  };
+  add_table(*block._bterm_tbl);
+  add_table(*block._iterm_tbl);
+  add_table(*block._net_tbl);
+  add_table(*block._inst_hdr_tbl);
   if (db->isSchema(db_schema_db_remove_hash)) {
-    stream << *block._module_tbl;
-    stream << *block._inst_tbl;
+    add_table(*block._module_tbl);
+    add_table(*block._inst_tbl);
   } else {
-    stream << *block._inst_tbl;
-    stream << *block._module_tbl;
+    add_table(*block._inst_tbl);
+    add_table(*block._module_tbl);
   }
-  stream << *block._modinst_tbl;
+  add_table(*block._modinst_tbl);
   if (db->isSchema(db_schema_update_hierarchy)) {
-    stream << *block._modbterm_tbl;
+    add_table(*block._modbterm_tbl);
     if (db->isSchema(db_schema_db_remove_hash)) {
-      stream << *block._busport_tbl;
-    }
-    stream << *block._moditerm_tbl;
-    stream << *block._modnet_tbl;
-  }
-  stream << *block._powerdomain_tbl;
-  stream << *block._logicport_tbl;
-  stream << *block._powerswitch_tbl;
-  stream << *block._isolation_tbl;
-  stream << *block._levelshifter_tbl;
-  stream << *block._group_tbl;
-  stream << *block.ap_tbl_;
-  stream << *block.global_connect_tbl_;
-  stream << *block._guide_tbl;
-  stream << *block._net_tracks_tbl;
-  stream << *block._box_tbl;
-  stream << *block._via_tbl;
-  stream << *block._gcell_grid_tbl;
-  stream << *block._track_grid_tbl;
-  stream << *block._obstruction_tbl;
-  stream << *block._blockage_tbl;
-  stream << *block._wire_tbl;
-  stream << *block._swire_tbl;
-  stream << *block._sbox_tbl;
-  stream << *block._row_tbl;
-  stream << *block._fill_tbl;
-  stream << *block._region_tbl;
-  stream << *block._hier_tbl;
-  stream << *block._bpin_tbl;
-  stream << *block._non_default_rule_tbl;
-  stream << *block._layer_rule_tbl;
-  stream << *block._prop_tbl;
-
-  stream << *block._name_cache;
-  stream << *block._r_val_tbl;
-  stream << *block._c_val_tbl;
-  stream << *block._cc_val_tbl;
-  stream << NamedTable("cap_node_tbl", block._cap_node_tbl);
-  stream << NamedTable("r_seg_tbl", block._r_seg_tbl);
-  stream << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+      add_table(*block._busport_tbl);
+    }
+    add_table(*block._moditerm_tbl);
+    add_table(*block._modnet_tbl);
+  }
+  add_table(*block._powerdomain_tbl);
+  add_table(*block._logicport_tbl);
+  add_table(*block._powerswitch_tbl);
+  add_table(*block._isolation_tbl);
+  add_table(*block._levelshifter_tbl);
+  add_table(*block._group_tbl);
+  add_table(*block.ap_tbl_);
+  add_table(*block.global_connect_tbl_);
+  add_table(*block._guide_tbl);
+  add_table(*block._net_tracks_tbl);
+  add_table(*block._box_tbl);
+  add_table(*block._via_tbl);
+  add_table(*block._gcell_grid_tbl);
+  add_table(*block._track_grid_tbl);
+  add_table(*block._obstruction_tbl);
+  add_table(*block._blockage_tbl);
+  add_table(*block._wire_tbl);
+  add_table(*block._swire_tbl);
+  add_table(*block._sbox_tbl);
+  add_table(*block._row_tbl);
+  add_table(*block._fill_tbl);
+  add_table(*block._region_tbl);
+  add_table(*block._hier_tbl);
+  add_table(*block._bpin_tbl);
+  add_table(*block._non_default_rule_tbl);
+  add_table(*block._layer_rule_tbl);
+  add_table(*block._prop_tbl);
+
+  add_table(*block._name_cache);
+  add_table(*block._r_val_tbl);
+  add_table(*block._c_val_tbl);
+  add_table(*block._cc_val_tbl);
+  table_writers.emplace_back([&block](dbOStream& s) {
+    s << NamedTable("cap_node_tbl", block._cap_node_tbl);
+  });
+  table_writers.emplace_back([&block](dbOStream& s) {
+    s << NamedTable("r_seg_tbl", block._r_seg_tbl);
+  });
+  table_writers.emplace_back([&block](dbOStream& s) {
+    s << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+  });
+  stream.writeTableFrames(table_writers);
+
   stream << *block._extControl;
   stream << block._dft;
   stream << *block._dft_tbl;
@@ -884,6 +914,135 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   return stream;
 }
 
+// Reads the object tables written before db_schema_block_table_frames.
+static void readTables(dbIStream& stream, _dbBlock& block)
+{
+  _dbDatabase* db = block.getImpl()->getDatabase();
+
+  stream >> *block._bterm_tbl;
+  stream >> *block._iterm_tbl;
+  stream >> *block._net_tbl;
+  stream >> *block._inst_hdr_tbl;
+  if (db->isSchema(db_schema_db_remove_hash)) {
+    stream >> *block._module_tbl;
+    stream >> *block._inst_tbl;
+  } else {
+    stream >> *block._inst_tbl;
+    stream >> *block._module_tbl;
+  }
+  stream >> *block._modinst_tbl;
+  if (db->isSchema(db_schema_update_hierarchy)) {
+    stream >> *block._modbterm_tbl;
+    if (db->isSchema(db_schema_db_remove_hash)) {
+      stream >> *block._busport_tbl;
+    }
+    stream >> *block._moditerm_tbl;
+    stream >> *block._modnet_tbl;
+  }
+  stream >> *block._powerdomain_tbl;
+  stream >> *block._logicport_tbl;
+  stream >> *block._powerswitch_tbl;
+  stream >> *block._isolation_tbl;
+  if (db->isSchema(db_schema_level_shifter)) {
+    stream >> *block._levelshifter_tbl;
+  }
+  stream >> *block._group_tbl;
+  stream >> *block.ap_tbl_;
+  if (db->isSchema(db_schema_add_global_connect)) {
+    stream >> *block.global_connect_tbl_;
+  }
+  stream >> *block._guide_tbl;
+  if (db->isSchema(db_schema_net_tracks)) {
+    stream >> *block._net_tracks_tbl;
+  }
+  stream >> *block._box_tbl;
+  stream >> *block._via_tbl;
+  stream >> *block._gcell_grid_tbl;
+  stream >> *block._track_grid_tbl;
+  stream >> *block._obstruction_tbl;
+  stream >> *block._blockage_tbl;
+  stream >> *block._wire_tbl;
+  stream >> *block._swire_tbl;
+  stream >> *block._sbox_tbl;
+  stream >> *block._row_tbl;
+  stream >> *block._fill_tbl;
+  stream >> *block._region_tbl;
+  stream >> *block._hier_tbl;
+  stream >> *block._bpin_tbl;
+  stream >> *block._non_default_rule_tbl;
+  stream >> *block._layer_rule_tbl;
+  stream >> *block._prop_tbl;
+  stream >> *block._name_cache;
+  stream >> *block._r_val_tbl;
+  stream >> *block._c_val_tbl;
+  stream >> *block._cc_val_tbl;
+  stream >> *block._cap_node_tbl;  // DKF
+  stream >> *block._r_seg_tbl;     // DKF
+  stream >> *block._cc_seg_tbl;
+}
+
+// Reads the table frames written by operator<<.  The hierarchy tables
+// update the hashes of the modules and module instances as they are read,
+// so they are read in order as one group; the other tables are read
+// concurrently.
+static void readTableFrames(dbIStream& stream, _dbBlock& block)
+{
+  std::vector<std::vector<dbIStream::TableReader>> groups;
+  auto read_table = [](auto& table) {
+    return [&table](dbIStream& s) { s >> table; };
+  };
+  groups.push_back({read_table(*block._bterm_tbl)});
+  groups.push_back({read_table(*block._iterm_tbl)});
+  groups.push_back({read_table(*block._net_tbl)});
+  groups.push_back({read_table(*block._inst_hdr_tbl)});
+  groups.push_back({read_table(*block._module_tbl),
+                    read_table(*block._inst_tbl),
+                    read_table(*block._modinst_tbl),
+                    read_table(*block._modbterm_tbl),
+                    read_table(*block._busport_tbl),
+                    read_table(*block._moditerm_tbl),
+                    read_table(*block._modnet_tbl)});
+  const std::vector<dbIStream::TableReader> readers = {
+      read_table(*block._powerdomain_tbl),
+      read_table(*block._logicport_tbl),
+      read_table(*block._powerswitch_tbl),
+      read_table(*block._isolation_tbl),
+      read_table(*block._levelshifter_tbl),
+      read_table(*block._group_tbl),
+      read_table(*block.ap_tbl_),
+      read_table(*block.global_connect_tbl_),
+      read_table(*block._guide_tbl),
+      read_table(*block._net_tracks_tbl),
+      read_table(*block._box_tbl),
+      read_table(*block._via_tbl),
+      read_table(*block._gcell_grid_tbl),
+      read_table(*block._track_grid_tbl),
+      read_table(*block._obstruction_tbl),
+      read_table(*block._blockage_tbl),
+      read_table(*block._wire_tbl),
+      read_table(*block._swire_tbl),
+      read_table(*block._sbox_tbl),
+      read_table(*block._row_tbl),
+      read_table(*block._fill_tbl),
+      read_table(*block._region_tbl),
+      read_table(*block._hier_tbl),
+      read_table(*block._bpin_tbl),
+      read_table(*block._non_default_rule_tbl),
+      read_table(*block._layer_rule_tbl),
+      read_table(*block._prop_tbl),
+      read_table(*block._name_cache),
+      read_table(*block._r_val_tbl),
+      read_table(*block._c_val_tbl),
+      read_table(*block._cc_val_tbl),
+      read_table(*block._cap_node_tbl),
+      read_table(*block._r_seg_tbl),
+      read_table(*block._cc_seg_tbl)};
+  for (const auto& reader : readers) {
+    groups.push_back({reader});
+  }
+  stream.readTableFrames(groups);
+}
+
 dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
 {
   _dbDatabase* db = block.getImpl()->getDatabase();
@@ -960,66 +1119,11 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
     stream >> block._component_mask_shift;
   }
   stream >> block._currentCcAdjOrder;
-  stream >> *block._bterm_tbl;
-  stream >> *block._iterm_tbl;
-  stream >> *block._net_tbl;
-  stream >> *block._inst_hdr_tbl;
-  if (db->isSchema(db_schema_db_remove_hash)) {
-    stream >> *block._module_tbl;
-    stream >> *block._inst_tbl;
+  if (db->isSchema(db_schema_block_table_frames)) {
+    readTableFrames(stream, block);
   } else {
-    stream >> *block._inst_tbl;
-    stream >> *block._module_tbl;
-  }
-  stream >> *block._modinst_tbl;
-  if (db->isSchema(db_schema_update_hierarchy)) {
-    stream >> *block._modbterm_tbl;
-    if (db->isSchema(db_schema_db_remove_hash)) {
-      stream >> *block._busport_tbl;
-    }
-    stream >> *block._moditerm_tbl;
-    stream >> *block._modnet_tbl;
-  }
-  stream >> *block._powerdomain_tbl;
-  stream >> *block._logicport_tbl;
-  stream >> *block._powerswitch_tbl;
-  stream >> *block._isolation_tbl;
-  if (db->isSchema(db_schema_level_shifter)) {
-    stream >> *block._levelshifter_tbl;
-  }
-  stream >> *block._group_tbl;
-  stream >> *block.ap_tbl_;
-  if (db->isSchema(db_schema_add_global_connect)) {
-    stream >> *block.global_connect_tbl_;
-  }
-  stream >> *block._guide_tbl;
-  if (db->isSchema(db_schema_net_tracks)) {
-    stream >> *block._net_tracks_tbl;
+    readTables(stream, block);
   }
-  stream >> *block._box_tbl;
-  stream >> *block._via_tbl;
-  stream >> *block._gcell_grid_tbl;
-  stream >> *block._track_grid_tbl;
-  stream >> *block._obstruction_tbl;
-  stream >> *block._blockage_tbl;
-  stream >> *block._wire_tbl;
-  stream >> *block._swire_tbl;
-  stream >> *block._sbox_tbl;
-  stream >> *block._row_tbl;
-  stream >> *block._fill_tbl;
-  stream >> *block._region_tbl;
-  stream >> *block._hier_tbl;
-  stream >> *block._bpin_tbl;
-  stream >> *block._non_default_rule_tbl;
-  stream >> *block._layer_rule_tbl;
-  stream >> *block._prop_tbl;
-  stream >> *block._name_cache;
-  stream >> *block._r_val_tbl;
-  stream >> *block._c_val_tbl;
-  stream >> *block._cc_val_tbl;
-  stream >> *block._cap_node_tbl;  // DKF
-  stream >> *block._r_seg_tbl;     // DKF
-  stream >> *block._cc_seg_tbl;
   stream >> *block._extControl;
   if (db->isSchema(db_schema_add_scan)) {
     stream >> block._dft;
@@ -1887,6 +1991,15 @@ dbInst* dbBlock::findInst(const char* name)
   return (dbInst*) block->_inst_hash.find(name);
 }
 
+void dbBlock::reserveInsts(uint num_insts)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->_inst_tbl->reserve(num_insts);
+  // the bounding box of each instance
+  block->_box_tbl->reserve(num_insts);
+  block->_inst_hash.reserve(block->_inst_hash._num_entries + num_insts);
+}
+
 dbModule* dbBlock::findModule(const char* name)
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -2013,6 +2126,45 @@ dbNet* dbBlock::findNet(const char* name)
   return (dbNet*) block->_net_hash.find(name);
 }
 
+void dbBlock::reserveNets(uint num_nets)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->_net_tbl->reserve(num_nets);
+  block->_net_hash.reserve(block->_net_hash._num_entries + num_nets);
+}
+
+const dbWireShapes& dbBlock::getWireShapes(int num_threads)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  if (!block->_wire_shape_cache) {
+    block->_wire_shape_cache = new dbWireShapeCache(this);
+  }
+  return block->_wire_shape_cache->getShapes(num_threads);
+}
+
+const dbShapeIndex* dbBlock::getShapeIndex(int num_threads)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  if (!block->_shape_index) {
+    // The wire shape snapshot is only needed to build the index; don't keep
+    // it around unless the client had asked for it already.
+    const bool had_wire_shapes = block->_wire_shape_cache != nullptr;
+    block->_shape_index = new dbShapeIndex(this, num_threads);
+    if (!had_wire_shapes) {
+      delete block->_wire_shape_cache;
+      block->_wire_shape_cache = nullptr;
+    }
+  }
+  return block->_shape_index;
+}
+
+void dbBlock::releaseShapeIndex()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  delete block->_shape_index;
+  block->_shape_index = nullptr;
+}
+
 dbVia* dbBlock::findVia(const char* name)
 {
   for (dbVia* via : getVias()) {
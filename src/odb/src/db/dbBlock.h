@@ -75,6 +75,7 @@ class _dbGuide;
 class _dbNetTrack;
 class _dbMarkerCategory;
 class dbJournal;
+class dbCheckpointJournal;
 
 class dbNetBTermItr;
 class dbBPinItr;
@@ -109,6 +110,8 @@ class dbIStream;
 class dbOStream;
 class dbBlockSearch;
 class dbBlockCallBackObj;
+class dbWireShapeCache;
+class dbShapeIndex;
 class dbGuideItr;
 class dbNetTrackItr;
 class _dbDft;
@@ -292,6 +295,9 @@ class _dbBlock : public _dbObject
 
   dbJournal* _journal;
   dbJournal* _journal_pending;
+  dbCheckpointJournal* _checkpoint;
+  dbWireShapeCache* _wire_shape_cache;
+  dbShapeIndex* _shape_index;
 
   _dbBlock(_dbDatabase* db);
   ~_dbBlock();
@@ -3,7 +3,10 @@
 
 #include "odb/dbBlockCallBackObj.h"
 
+#include <vector>
+
 #include "dbBlock.h"
+#include "odb/db.h"
 
 namespace odb {
 
@@ -13,6 +16,23 @@ namespace odb {
 //
 ////////////////////////////////////////////////////////////////////
 
+void dbBlockCallBackObj::inDbInstsCreate(const std::vector<dbInst*>& insts)
+{
+  for (dbInst* inst : insts) {
+    inDbInstCreate(inst);
+    for (dbITerm* iterm : inst->getITerms()) {
+      inDbITermCreate(iterm);
+    }
+  }
+}
+
+void dbBlockCallBackObj::inDbNetsCreate(const std::vector<dbNet*>& nets)
+{
+  for (dbNet* net : nets) {
+    inDbNetCreate(net);
+  }
+}
+
 void dbBlockCallBackObj::addOwner(dbBlock* new_owner)
 {
   if (!new_owner) {
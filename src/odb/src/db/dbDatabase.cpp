@@ -443,18 +443,23 @@ dbTech* dbDatabase::getTech()
       utl::ODB, 432, "getTech() is obsolete in a multi-tech db");
 }
 
-void dbDatabase::read(std::istream& file)
+void dbDatabase::read(std::istream& file, int num_threads)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbIStream stream(db, file);
+  stream.setNumThreads(num_threads);
   stream >> *db;
   ((dbDatabase*) db)->triggerPostReadDb();
 }
 
-void dbDatabase::write(std::ostream& file)
+void dbDatabase::write(std::ostream& file,
+                       int num_threads,
+                       bool compress_tables)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
+  stream.setNumThreads(num_threads);
+  stream.setCompressTables(compress_tables);
   stream << *db;
   file.flush();
 }
@@ -463,7 +468,9 @@ void dbDatabase::beginEco(dbBlock* block_)
 {
   _dbBlock* block = (_dbBlock*) block_;
 
-  {
+  if (block->_checkpoint && !block->_checkpoint->inEco()) {
+    block->_checkpoint->suspend(block->_journal);
+  } else {
     delete block->_journal;
   }
 
@@ -474,14 +481,24 @@ void dbDatabase::beginEco(dbBlock* block_)
 void dbDatabase::endEco(dbBlock* block_)
 {
   _dbBlock* block = (_dbBlock*) block_;
-  dbJournal* eco = block->_journal;
-  block->_journal = nullptr;
+  dbCheckpointJournal* checkpoint = block->_checkpoint;
+
+  dbJournal* eco = nullptr;
+  if (checkpoint == nullptr || checkpoint->inEco()) {
+    eco = block->_journal;
+    block->_journal = nullptr;
+  }
 
   {
     delete block->_journal_pending;
   }
 
   block->_journal_pending = eco;
+
+  if (eco && checkpoint) {
+    checkpoint->resume(*eco);
+    block->_journal = new dbJournal(block_);
+  }
 }
 
 bool dbDatabase::ecoEmpty(dbBlock* block_)
@@ -565,12 +582,134 @@ void dbDatabase::undoEco(dbBlock* block_)
   _dbBlock* block = (_dbBlock*) block_;
 
   if (block->_journal_pending) {
+    dbCheckpointJournal* checkpoint = block->_checkpoint;
+    const bool recording = checkpoint && !checkpoint->inEco();
+    if (recording && !block->_journal_pending->empty()) {
+      checkpoint->undoEco(block->_journal);
+    }
+
+    // The undo restores fields directly, so it must not be recorded as
+    // new edits in the checkpoint.
+    dbJournal* journal = block->_journal;
+    if (recording) {
+      block->_journal = nullptr;
+    }
     block->_journal_pending->undo();
+    block->_journal = journal;
+
     delete block->_journal_pending;
     block->_journal_pending = nullptr;
   }
 }
 
+void dbDatabase::beginCheckpoint(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  dbCheckpointJournal* checkpoint = block->_checkpoint;
+
+  // A recording checkpoint owns the block journal; only a journal of an
+  // open eco (with or without a checkpoint) prevents starting over.
+  const bool eco_open
+      = checkpoint ? checkpoint->inEco() : block->_journal != nullptr;
+  if (eco_open) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB,
+        1116,
+        "Can't begin a checkpoint on block {} while an eco is open.",
+        block_->getName());
+  }
+
+  // Starting a new checkpoint drops the changes recorded against the
+  // previous base.
+  endCheckpoint(block_);
+  block->_checkpoint = new dbCheckpointJournal;
+  block->_journal = new dbJournal(block_);
+}
+
+void dbDatabase::endCheckpoint(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  dbCheckpointJournal* checkpoint = block->_checkpoint;
+
+  if (checkpoint == nullptr) {
+    return;
+  }
+
+  if (!checkpoint->inEco()) {
+    delete block->_journal;
+    block->_journal = nullptr;
+  }
+
+  delete checkpoint;
+  block->_checkpoint = nullptr;
+}
+
+bool dbDatabase::hasCheckpoint(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  return block->_checkpoint && block->_checkpoint->isValid();
+}
+
+void dbDatabase::writeCheckpoint(dbBlock* block_, std::ostream& file)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  dbCheckpointJournal* checkpoint = block->_checkpoint;
+  utl::Logger* logger = block->getImpl()->getLogger();
+
+  if (checkpoint == nullptr) {
+    logger->error(utl::ODB,
+                  1117,
+                  "No checkpoint is being recorded on block {}.",
+                  block_->getName());
+  }
+  if (!checkpoint->isValid()) {
+    logger->error(utl::ODB,
+                  1113,
+                  "The checkpoint of block {} is incomplete as an eco was "
+                  "undone after later edits. Write the full database instead.",
+                  block_->getName());
+  }
+
+  std::vector<const dbJournal*> segments(checkpoint->getSegments().begin(),
+                                         checkpoint->getSegments().end());
+  if (!checkpoint->inEco() && block->_journal && !block->_journal->empty()) {
+    segments.push_back(block->_journal);
+  }
+
+  dbOStream stream(block->getDatabase(), file);
+  stream << block->_name;
+  stream << (uint) segments.size();
+  for (const dbJournal* segment : segments) {
+    stream << *segment;
+  }
+  file.flush();
+}
+
+void dbDatabase::readCheckpoint(dbBlock* block_, std::istream& file)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  dbIStream stream(block->getDatabase(), file);
+  std::string block_name;
+  stream >> block_name;
+  if (block_name != block->_name) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB,
+        1114,
+        "Checkpoint was written for block {}, not {}.",
+        block_name,
+        block_->getName());
+  }
+
+  uint num_segments;
+  stream >> num_segments;
+  for (uint i = 0; i < num_segments; ++i) {
+    dbJournal segment(block_);
+    stream >> segment;
+    segment.redo();
+  }
+}
+
 void dbDatabase::setLogger(utl::Logger* logger)
 {
   _dbDatabase* _db = (_dbDatabase*) this;
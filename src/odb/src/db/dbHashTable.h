@@ -54,6 +54,10 @@ class dbHashTable
   int hasMember(const char* name);
   void insert(T* object);
   void remove(T* object);
+
+  // Size the table for num_entries entries so inserting them doesn't
+  // grow the table repeatedly.
+  void reserve(uint num_entries);
 };
 
 template <class T>
@@ -160,6 +160,27 @@ void dbHashTable<T>::insert(T* object)
   e = object->getOID();
 }
 
+template <class T>
+void dbHashTable<T>::reserve(uint num_entries)
+{
+  uint sz = 1;
+  while (sz * CHAIN_LENGTH < num_entries) {
+    sz <<= 1;
+  }
+
+  if (_hash_tbl.size() == 0) {
+    dbId<T> nullId;
+    for (uint i = 0; i < sz; ++i) {
+      _hash_tbl.push_back(nullId);
+    }
+    return;
+  }
+
+  while (_hash_tbl.size() < sz) {
+    growTable();
+  }
+}
+
 template <class T>
 T* dbHashTable<T>::find(const char* name)
 {
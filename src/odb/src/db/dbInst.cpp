@@ -1236,25 +1236,28 @@ dbInst* dbInst::create(dbBlock* block_,
   return create(block_, master_, name_, nullptr, physical_only, target_module);
 }
 
-dbInst* dbInst::create(dbBlock* block_,
-                       dbMaster* master_,
-                       const char* name_,
-                       dbRegion* region,
-                       bool physical_only,
-                       dbModule* parent_module)
+static _dbInstHdr* getInstHdr(_dbBlock* block, dbMaster* master_)
 {
-  _dbBlock* block = (_dbBlock*) block_;
-  if (block->_inst_hash.hasMember(name_)) {
-    return nullptr;
-  }
-
   _dbMaster* master = (_dbMaster*) master_;
   _dbInstHdr* inst_hdr = block->_inst_hdr_hash.find(master->_id);
   if (inst_hdr == nullptr) {
     inst_hdr
         = (_dbInstHdr*) dbInstHdr::create((dbBlock*) block, (dbMaster*) master);
   }
+  return inst_hdr;
+}
 
+// Creates the instance with its iterms and bbox and adds it to its module
+// and region. Callbacks are left to the caller.
+static _dbInst* createInst(_dbBlock* block,
+                           dbMaster* master_,
+                           _dbInstHdr* inst_hdr,
+                           const char* name_,
+                           dbRegion* region,
+                           bool physical_only,
+                           dbModule* parent_module)
+{
+  _dbMaster* master = (_dbMaster*) master_;
   _dbInst* inst = block->_inst_tbl->create();
 
   if (block->_journal) {
@@ -1304,12 +1307,34 @@ dbInst* dbInst::create(dbBlock* block_,
     if (parent_module) {
       parent_module->addInst((dbInst*) inst);
     } else {
-      block_->getTopModule()->addInst((dbInst*) inst);
+      ((dbBlock*) block)->getTopModule()->addInst((dbInst*) inst);
     }
   }
 
   if (region) {
     region->addInst((dbInst*) inst);
+  }
+
+  return inst;
+}
+
+dbInst* dbInst::create(dbBlock* block_,
+                       dbMaster* master_,
+                       const char* name_,
+                       dbRegion* region,
+                       bool physical_only,
+                       dbModule* parent_module)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  if (block->_inst_hash.hasMember(name_)) {
+    return nullptr;
+  }
+
+  _dbInstHdr* inst_hdr = getInstHdr(block, master_);
+  _dbInst* inst = createInst(
+      block, master_, inst_hdr, name_, region, physical_only, parent_module);
+
+  if (region) {
     for (dbBlockCallBackObj* cb : block->_callbacks) {
       cb->inDbInstCreate((dbInst*) inst, region);
     }
@@ -1319,8 +1344,8 @@ dbInst* dbInst::create(dbBlock* block_,
     }
   }
 
-  for (int i = 0; i < mterm_cnt; ++i) {
-    _dbITerm* iterm = block->_iterm_tbl->getPtr(inst->_iterms[i]);
+  for (const uint iterm_id : inst->_iterms) {
+    _dbITerm* iterm = block->_iterm_tbl->getPtr(iterm_id);
     for (dbBlockCallBackObj* cb : block->_callbacks) {
       cb->inDbITermCreate((dbITerm*) iterm);
     }
@@ -1329,6 +1354,48 @@ dbInst* dbInst::create(dbBlock* block_,
   return (dbInst*) inst;
 }
 
+std::vector<dbInst*> dbInst::create(dbBlock* block_,
+                                    dbMaster* master_,
+                                    const std::vector<std::string>& names,
+                                    bool physical_only,
+                                    dbModule* parent_module)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  const uint num_insts = names.size();
+  const uint mterm_cnt = master_->getMTermCount();
+
+  block->_iterm_tbl->reserve(num_insts * mterm_cnt);
+  block_->reserveInsts(num_insts);
+
+  _dbInstHdr* inst_hdr = getInstHdr(block, master_);
+
+  std::vector<dbInst*> insts;
+  insts.reserve(num_insts);
+  std::vector<dbInst*> created;
+  created.reserve(num_insts);
+  for (const std::string& name : names) {
+    if (block->_inst_hash.hasMember(name.c_str())) {
+      insts.push_back(nullptr);
+      continue;
+    }
+    dbInst* inst = (dbInst*) createInst(block,
+                                        master_,
+                                        inst_hdr,
+                                        name.c_str(),
+                                        nullptr,
+                                        physical_only,
+                                        parent_module);
+    insts.push_back(inst);
+    created.push_back(inst);
+  }
+
+  for (dbBlockCallBackObj* cb : block->_callbacks) {
+    cb->inDbInstsCreate(created);
+  }
+
+  return insts;
+}
+
 dbInst* dbInst::create(dbBlock* top_block,
                        dbBlock* child_block,
                        const char* name)
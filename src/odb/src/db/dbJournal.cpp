@@ -2456,4 +2456,45 @@ dbIStream& operator>>(dbIStream& stream, dbJournal& journal)
   return stream;
 }
 
+dbCheckpointJournal::~dbCheckpointJournal()
+{
+  for (dbJournal* segment : _segments) {
+    delete segment;
+  }
+}
+
+void dbCheckpointJournal::suspend(dbJournal* segment)
+{
+  if (segment->empty()) {
+    delete segment;
+  } else {
+    _segments.push_back(segment);
+  }
+  _eco_segment = -1;
+  _in_eco = true;
+}
+
+void dbCheckpointJournal::resume(const dbJournal& eco)
+{
+  if (!eco.empty()) {
+    _segments.push_back(new dbJournal(eco));
+    _eco_segment = _segments.size() - 1;
+  }
+  _in_eco = false;
+}
+
+void dbCheckpointJournal::undoEco(const dbJournal* active)
+{
+  const bool eco_is_last = _eco_segment >= 0
+                           && _eco_segment == (int) _segments.size() - 1
+                           && (active == nullptr || active->empty());
+  if (eco_is_last) {
+    delete _segments.back();
+    _segments.pop_back();
+  } else {
+    _valid = false;
+  }
+  _eco_segment = -1;
+}
+
 }  // namespace odb
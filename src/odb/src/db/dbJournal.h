@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "dbJournalLog.h"
 #include "odb/odb.h"
@@ -162,4 +163,42 @@ class dbJournal
 dbIStream& operator>>(dbIStream& stream, dbJournal& jrnl);
 dbOStream& operator<<(dbOStream& stream, const dbJournal& jrnl);
 
+//
+// dbCheckpointJournal: the journaled edits of a block since its base
+// database was read or written, kept as a sequence of journals that are
+// replayed in order.
+//
+// While no eco is open the block's _journal is the segment being recorded.
+// beginEco hands that segment over to the checkpoint. When the eco ends a
+// copy of it is kept as a segment of its own, and it is dropped again if
+// the eco is undone before anything else is recorded.
+//
+class dbCheckpointJournal
+{
+ public:
+  ~dbCheckpointJournal();
+
+  bool inEco() const { return _in_eco; }
+  bool isValid() const { return _valid; }
+
+  // Called by beginEco; takes ownership of the recorded segment.
+  void suspend(dbJournal* segment);
+
+  // Called by endEco; keeps a copy of the finished eco.
+  void resume(const dbJournal& eco);
+
+  // Called by undoEco before the pending eco is undone.  If the eco is not
+  // the last thing recorded the undo can't be represented and the
+  // checkpoint becomes invalid.
+  void undoEco(const dbJournal* active);
+
+  const std::vector<dbJournal*>& getSegments() const { return _segments; }
+
+ private:
+  std::vector<dbJournal*> _segments;
+  int _eco_segment{-1};
+  bool _in_eco{false};
+  bool _valid{true};
+};
+
 }  // namespace odb
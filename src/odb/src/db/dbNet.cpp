@@ -2077,14 +2077,8 @@ void dbNet::destroySWires()
   net->_swires = 0;
 }
 
-dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
+static _dbNet* createNet(_dbBlock* block, const char* name_)
 {
-  _dbBlock* block = (_dbBlock*) block_;
-
-  if (!skipExistingCheck && block->_net_hash.hasMember(name_)) {
-    return nullptr;
-  }
-
   _dbNet* net = block->_net_tbl->create();
   if (block->_journal) {
     debugPrint(block->getImpl()->getLogger(),
@@ -2102,6 +2096,18 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
 
   net->_name = safe_strdup(name_);
   block->_net_hash.insert(net);
+  return net;
+}
+
+dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  if (!skipExistingCheck && block->_net_hash.hasMember(name_)) {
+    return nullptr;
+  }
+
+  _dbNet* net = createNet(block, name_);
 
   for (auto cb : block->_callbacks) {
     cb->inDbNetCreate((dbNet*) net);
@@ -2110,6 +2116,35 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
   return (dbNet*) net;
 }
 
+std::vector<dbNet*> dbNet::create(dbBlock* block_,
+                                  const std::vector<std::string>& names,
+                                  bool skipExistingCheck)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  block_->reserveNets(names.size());
+
+  std::vector<dbNet*> nets;
+  nets.reserve(names.size());
+  std::vector<dbNet*> created;
+  created.reserve(names.size());
+  for (const std::string& name : names) {
+    if (!skipExistingCheck && block->_net_hash.hasMember(name.c_str())) {
+      nets.push_back(nullptr);
+      continue;
+    }
+    dbNet* net = (dbNet*) createNet(block, name.c_str());
+    nets.push_back(net);
+    created.push_back(net);
+  }
+
+  for (auto cb : block->_callbacks) {
+    cb->inDbNetsCreate(created);
+  }
+
+  return nets;
+}
+
 void dbNet::destroy(dbNet* net_)
 {
   _dbNet* net = (_dbNet*) net_;
@@ -0,0 +1,349 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#include "odb/dbShapeIndex.h"
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbShape.h"
+
+namespace odb {
+
+namespace bgi = boost::geometry::index;
+
+dbShapeIndex::dbShapeIndex(dbBlock* block, int num_threads) : block_(block)
+{
+  for (dbTechLayer* layer : block->getTech()->getLayers()) {
+    layers_[layer];
+  }
+  build(num_threads);
+  addOwner(block);
+}
+
+void dbShapeIndex::build(int num_threads)
+{
+  std::vector<dbTechLayer*> layers;
+  std::vector<std::vector<RectValue<dbNet*>>> wire_values;
+  std::vector<std::vector<RectValue<dbSBox*>>> swire_values;
+  std::vector<std::vector<RectValue<dbObstruction*>>> obs_values;
+  std::map<dbTechLayer*, int> layer_index;
+  std::map<int, dbTechLayer*> layer_by_number;
+  for (auto& [layer, trees] : layers_) {
+    layer_index[layer] = layers.size();
+    layer_by_number[layer->getNumber()] = layer;
+    layers.push_back(layer);
+  }
+  wire_values.resize(layers.size());
+  swire_values.resize(layers.size());
+  obs_values.resize(layers.size());
+
+  const dbWireShapes& wire_shapes = block_->getWireShapes(num_threads);
+  for (size_t i = 0; i < wire_shapes.size(); i++) {
+    dbTechLayer* layer = layer_by_number.at(wire_shapes.layer[i]);
+    dbNet* net = dbNet::getNet(block_, wire_shapes.net_id[i]);
+    const Rect rect(wire_shapes.xlo[i],
+                    wire_shapes.ylo[i],
+                    wire_shapes.xhi[i],
+                    wire_shapes.yhi[i]);
+    wire_values[layer_index[layer]].emplace_back(rect, net);
+    net_wire_shapes_[net].emplace_back(layer, rect);
+  }
+
+  LayerShapes shapes;
+  for (dbNet* net : block_->getNets()) {
+    for (dbSWire* swire : net->getSWires()) {
+      for (dbSBox* sbox : swire->getWires()) {
+        shapes.clear();
+        getSBoxShapes(sbox, shapes);
+        for (const auto& [layer, rect] : shapes) {
+          swire_values[layer_index[layer]].emplace_back(rect, sbox);
+        }
+      }
+    }
+  }
+
+  for (dbObstruction* obs : block_->getObstructions()) {
+    dbBox* box = obs->getBBox();
+    obs_values[layer_index[box->getTechLayer()]].emplace_back(box->getBox(),
+                                                              obs);
+  }
+
+  std::vector<RectValue<dbInst*>> inst_values;
+  for (dbInst* inst : block_->getInsts()) {
+    const Rect box = inst->getBBox()->getBox();
+    inst_values.emplace_back(box, inst);
+    inst_boxes_[inst] = box;
+  }
+
+  // Bulk loading packs the trees, which is much faster than inserting one
+  // value at a time, and each layer is independent.
+  const int num_layers = layers.size();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+  for (int i = 0; i < num_layers; i++) {
+    Layer& trees = layers_.at(layers[i]);
+    trees.wires = Rtree<dbNet*>(wire_values[i]);
+    trees.swires = Rtree<dbSBox*>(swire_values[i]);
+    trees.obstructions = Rtree<dbObstruction*>(obs_values[i]);
+  }
+  insts_ = Rtree<dbInst*>(inst_values);
+}
+
+const dbShapeIndex::Layer* dbShapeIndex::findLayer(dbTechLayer* layer) const
+{
+  auto it = layers_.find(layer);
+  if (it == layers_.end()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void dbShapeIndex::findWires(dbTechLayer* layer,
+                             const Rect& rect,
+                             std::vector<RectValue<dbNet*>>& shapes) const
+{
+  const Layer* trees = findLayer(layer);
+  if (trees) {
+    trees->wires.query(bgi::intersects(rect), std::back_inserter(shapes));
+  }
+}
+
+void dbShapeIndex::findSpecialWires(
+    dbTechLayer* layer,
+    const Rect& rect,
+    std::vector<RectValue<dbSBox*>>& shapes) const
+{
+  const Layer* trees = findLayer(layer);
+  if (trees) {
+    trees->swires.query(bgi::intersects(rect), std::back_inserter(shapes));
+  }
+}
+
+void dbShapeIndex::findObstructions(
+    dbTechLayer* layer,
+    const Rect& rect,
+    std::vector<RectValue<dbObstruction*>>& shapes) const
+{
+  const Layer* trees = findLayer(layer);
+  if (trees) {
+    trees->obstructions.query(bgi::intersects(rect),
+                              std::back_inserter(shapes));
+  }
+}
+
+void dbShapeIndex::findInsts(const Rect& rect,
+                             std::vector<RectValue<dbInst*>>& insts) const
+{
+  insts_.query(bgi::intersects(rect), std::back_inserter(insts));
+}
+
+void dbShapeIndex::getWireShapes(dbWire* wire, LayerShapes& shapes)
+{
+  dbWireShapeItr itr;
+  dbShape shape;
+  std::vector<dbShape> via_boxes;
+  for (itr.begin(wire); itr.next(shape);) {
+    if (shape.isVia()) {
+      dbShape::getViaBoxes(shape, via_boxes);
+      for (const dbShape& box : via_boxes) {
+        shapes.emplace_back(box.getTechLayer(), box.getBox());
+      }
+    } else {
+      shapes.emplace_back(shape.getTechLayer(), shape.getBox());
+    }
+  }
+}
+
+void dbShapeIndex::getSBoxShapes(dbSBox* sbox, LayerShapes& shapes)
+{
+  if (sbox->isVia()) {
+    std::vector<dbShape> via_boxes;
+    sbox->getViaBoxes(via_boxes);
+    for (const dbShape& box : via_boxes) {
+      shapes.emplace_back(box.getTechLayer(), box.getBox());
+    }
+  } else {
+    shapes.emplace_back(sbox->getTechLayer(), sbox->getBox());
+  }
+}
+
+void dbShapeIndex::insertWire(dbNet* net)
+{
+  removeWire(net);
+  dbWire* wire = net->getWire();
+  if (!wire) {
+    return;
+  }
+  LayerShapes& shapes = net_wire_shapes_[net];
+  getWireShapes(wire, shapes);
+  for (const auto& [layer, rect] : shapes) {
+    layers_[layer].wires.insert({rect, net});
+  }
+}
+
+void dbShapeIndex::removeWire(dbNet* net)
+{
+  auto it = net_wire_shapes_.find(net);
+  if (it == net_wire_shapes_.end()) {
+    return;
+  }
+  for (const auto& [layer, rect] : it->second) {
+    layers_[layer].wires.remove({rect, net});
+  }
+  net_wire_shapes_.erase(it);
+}
+
+void dbShapeIndex::insertSBox(dbSBox* sbox)
+{
+  LayerShapes shapes;
+  getSBoxShapes(sbox, shapes);
+  for (const auto& [layer, rect] : shapes) {
+    layers_[layer].swires.insert({rect, sbox});
+  }
+}
+
+void dbShapeIndex::removeSBox(dbSBox* sbox)
+{
+  LayerShapes shapes;
+  getSBoxShapes(sbox, shapes);
+  for (const auto& [layer, rect] : shapes) {
+    layers_[layer].swires.remove({rect, sbox});
+  }
+}
+
+void dbShapeIndex::insertInst(dbInst* inst)
+{
+  const Rect box = inst->getBBox()->getBox();
+  insts_.insert({box, inst});
+  inst_boxes_[inst] = box;
+}
+
+void dbShapeIndex::removeInst(dbInst* inst)
+{
+  auto it = inst_boxes_.find(inst);
+  if (it == inst_boxes_.end()) {
+    return;
+  }
+  insts_.remove({it->second, inst});
+  inst_boxes_.erase(it);
+}
+
+void dbShapeIndex::inDbInstCreate(dbInst* inst)
+{
+  insertInst(inst);
+}
+
+void dbShapeIndex::inDbInstCreate(dbInst* inst, dbRegion* /* region */)
+{
+  insertInst(inst);
+}
+
+void dbShapeIndex::inDbInstDestroy(dbInst* inst)
+{
+  removeInst(inst);
+}
+
+void dbShapeIndex::inDbInstSwapMasterBefore(dbInst* inst, dbMaster* master)
+{
+  removeInst(inst);
+}
+
+void dbShapeIndex::inDbInstSwapMasterAfter(dbInst* inst)
+{
+  insertInst(inst);
+}
+
+void dbShapeIndex::inDbPreMoveInst(dbInst* inst)
+{
+  removeInst(inst);
+}
+
+void dbShapeIndex::inDbPostMoveInst(dbInst* inst)
+{
+  insertInst(inst);
+}
+
+void dbShapeIndex::inDbNetDestroy(dbNet* net)
+{
+  removeWire(net);
+}
+
+void dbShapeIndex::inDbObstructionCreate(dbObstruction* obs)
+{
+  dbBox* box = obs->getBBox();
+  layers_[box->getTechLayer()].obstructions.insert({box->getBox(), obs});
+}
+
+void dbShapeIndex::inDbObstructionDestroy(dbObstruction* obs)
+{
+  dbBox* box = obs->getBBox();
+  layers_[box->getTechLayer()].obstructions.remove({box->getBox(), obs});
+}
+
+void dbShapeIndex::inDbWireDestroy(dbWire* wire)
+{
+  dbNet* net = wire->getNet();
+  if (net) {
+    removeWire(net);
+  }
+}
+
+void dbShapeIndex::inDbWirePostModify(dbWire* wire)
+{
+  dbNet* net = wire->getNet();
+  if (net) {
+    insertWire(net);
+  }
+}
+
+void dbShapeIndex::inDbWirePreAttach(dbWire* wire, dbNet* net)
+{
+  removeWire(net);
+  dbNet* old_net = wire->getNet();
+  if (old_net) {
+    removeWire(old_net);
+  }
+}
+
+void dbShapeIndex::inDbWirePostAttach(dbWire* wire)
+{
+  inDbWirePostModify(wire);
+}
+
+void dbShapeIndex::inDbWirePreDetach(dbWire* wire)
+{
+  inDbWireDestroy(wire);
+}
+
+void dbShapeIndex::inDbWirePostAppend(dbWire* src, dbWire* dst)
+{
+  inDbWirePostModify(dst);
+}
+
+void dbShapeIndex::inDbWirePostCopy(dbWire* src, dbWire* dst)
+{
+  inDbWirePostModify(dst);
+}
+
+void dbShapeIndex::inDbSWireAddSBox(dbSBox* sbox)
+{
+  insertSBox(sbox);
+}
+
+void dbShapeIndex::inDbSWireRemoveSBox(dbSBox* sbox)
+{
+  removeSBox(sbox);
+}
+
+void dbShapeIndex::inDbSWirePreDestroySBoxes(dbSWire* swire)
+{
+  for (dbSBox* sbox : swire->getWires()) {
+    removeSBox(sbox);
+  }
+}
+
+}  // namespace odb
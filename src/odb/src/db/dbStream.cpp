@@ -3,15 +3,90 @@
 
 #include "odb/dbStream.h"
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
 #include <iostream>
 #include <sstream>
+#include <streambuf>
 #include <string>
+#include <vector>
 
 #include "dbDatabase.h"
 #include "odb/db.h"
+#include "utl/Logger.h"
 
 namespace odb {
 
+namespace {
+
+// A table frame is the codec, the size of the serialized table, the number
+// of bytes stored and then the stored bytes.
+enum TableFrameCodec : unsigned char
+{
+  kRawTableFrame = 0,
+  kZlibTableFrame = 1
+};
+
+// Reads the bytes of a frame in place.
+class TableFrameBuf : public std::streambuf
+{
+ public:
+  TableFrameBuf(char* data, size_t size) { setg(data, data, data + size); }
+  size_t consumed() const { return gptr() - eback(); }
+};
+
+// Compresses the table in chunks, so that it is never copied whole.
+std::string deflateTable(std::streambuf* table, _dbDatabase* db)
+{
+  z_stream zs{};
+  if (deflateInit(&zs, Z_BEST_SPEED) != Z_OK) {
+    db->getLogger()->error(
+        utl::ODB, 1118, "Failed to compress a table of the db.");
+  }
+  std::string compressed;
+  std::array<char, 1 << 16> in;
+  std::array<char, 1 << 16> out;
+  int flush;
+  do {
+    const std::streamsize size = table->sgetn(in.data(), in.size());
+    flush = size < (std::streamsize) in.size() ? Z_FINISH : Z_NO_FLUSH;
+    zs.next_in = reinterpret_cast<Bytef*>(in.data());
+    zs.avail_in = size;
+    do {
+      zs.next_out = reinterpret_cast<Bytef*>(out.data());
+      zs.avail_out = out.size();
+      deflate(&zs, flush);
+      compressed.append(out.data(), out.size() - zs.avail_out);
+    } while (zs.avail_out == 0);
+  } while (flush != Z_FINISH);
+  deflateEnd(&zs);
+  return compressed;
+}
+
+std::string inflateTable(const std::string& compressed,
+                         uint64_t size,
+                         _dbDatabase* db)
+{
+  std::string table(size, '\0');
+  uLongf table_size = size;
+  const int status
+      = uncompress(reinterpret_cast<Bytef*>(table.data()),
+                   &table_size,
+                   reinterpret_cast<const Bytef*>(compressed.data()),
+                   compressed.size());
+  if (status != Z_OK || table_size != size) {
+    db->getLogger()->error(
+        utl::ODB, 1119, "A compressed table of the db is corrupt.");
+  }
+  return table;
+}
+
+}  // namespace
+
 void dbOStream::pushScope(const std::string& name)
 {
   int scope_pos = 0;
@@ -129,6 +204,153 @@ dbOStream::dbOStream(_dbDatabase* db, std::ostream& f) : _f(f)
   }
 }
 
+dbOStream::dbOStream(const dbOStream& parent, std::ostream& f)
+    : _db(parent._db),
+      _f(f),
+      _lef_area_factor(parent._lef_area_factor),
+      _lef_dist_factor(parent._lef_dist_factor),
+      _scopes(parent._scopes),
+      _compress_tables(parent._compress_tables)
+{
+}
+
+void dbOStream::writeTableFrames(const std::vector<TableWriter>& writers)
+{
+  int num_threads = _num_threads;
+  // io_size reports each scope as it is popped, which needs the tables
+  // written in order on this thread.
+  if (_db->getLogger()->debugCheck(utl::ODB, "io_size", 1)) {
+    num_threads = 1;
+  }
+
+  const int num_writers = writers.size();
+  std::exception_ptr error;
+#pragma omp parallel for ordered schedule(dynamic, 1) num_threads(num_threads)
+  for (int i = 0; i < num_writers; ++i) {
+    std::stringstream table(std::ios::in | std::ios::out | std::ios::binary);
+    uint64_t size = 0;
+    std::string compressed;
+    std::exception_ptr table_error;
+    try {
+      dbOStream table_stream(*this, table);
+      writers[i](table_stream);
+      size = table.tellp();
+      if (_compress_tables) {
+        compressed = deflateTable(table.rdbuf(), _db);
+        std::stringstream().swap(table);
+      }
+    } catch (...) {
+      table_error = std::current_exception();
+    }
+
+    // Frames are written in table order, each as soon as it and the ones
+    // before it are done.
+#pragma omp ordered
+    {
+      if (table_error && !error) {
+        error = table_error;
+      }
+      if (!error) {
+        try {
+          if (_compress_tables) {
+            *this << (unsigned char) kZlibTableFrame;
+            *this << size;
+            *this << (uint64_t) compressed.size();
+            _f.write(compressed.data(), compressed.size());
+          } else {
+            *this << (unsigned char) kRawTableFrame;
+            *this << size;
+            *this << size;
+            if (size > 0) {
+              _f << table.rdbuf();
+            }
+          }
+        } catch (...) {
+          error = std::current_exception();
+        }
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+dbIStream::dbIStream(const dbIStream& parent, std::istream& f)
+    : _f(f),
+      _db(parent._db),
+      _lef_area_factor(parent._lef_area_factor),
+      _lef_dist_factor(parent._lef_dist_factor)
+{
+}
+
+void dbIStream::readTableFrames(
+    const std::vector<std::vector<TableReader>>& groups)
+{
+  struct Frame
+  {
+    unsigned char codec;
+    uint64_t size;
+    std::string bytes;
+  };
+
+  const int num_groups = groups.size();
+  const int window = std::max(_num_threads, 1);
+  // Reads the frames of one group per thread at a time, so that only
+  // those are held in memory.
+  for (int begin = 0; begin < num_groups; begin += window) {
+    const int end = std::min(begin + window, num_groups);
+    std::vector<std::vector<Frame>> frames(end - begin);
+    for (int g = begin; g < end; ++g) {
+      for (size_t t = 0; t < groups[g].size(); ++t) {
+        Frame frame;
+        uint64_t stored_size;
+        *this >> frame.codec;
+        *this >> frame.size;
+        *this >> stored_size;
+        frame.bytes.resize(stored_size);
+        _f.read(frame.bytes.data(), stored_size);
+        frames[g - begin].push_back(std::move(frame));
+      }
+    }
+
+    std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(end - begin)
+    for (int g = begin; g < end; ++g) {
+      try {
+        for (size_t t = 0; t < groups[g].size(); ++t) {
+          Frame& frame = frames[g - begin][t];
+          if (frame.codec == kZlibTableFrame) {
+            frame.bytes = inflateTable(frame.bytes, frame.size, _db);
+          } else if (frame.codec != kRawTableFrame
+                     || frame.bytes.size() != frame.size) {
+            _db->getLogger()->error(
+                utl::ODB, 1120, "A table of the db has an invalid frame.");
+          }
+          TableFrameBuf buf(frame.bytes.data(), frame.bytes.size());
+          std::istream table(&buf);
+          table.exceptions(_f.exceptions());
+          dbIStream table_stream(*this, table);
+          groups[g][t](table_stream);
+          if (buf.consumed() != frame.size) {
+            _db->getLogger()->error(
+                utl::ODB, 1121, "A table of the db was not read completely.");
+          }
+          std::string().swap(frame.bytes);
+        }
+      } catch (...) {
+#pragma omp critical(dbIStream_readTableFrames)
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
 dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : _f(f)
 {
   _db = db;
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "dbCore.h"
@@ -41,6 +43,10 @@ class dbTable final : public dbObjectTable, public dbIterator
   // Create a "T", calls T( _dbDatabase * )
   T* create();
 
+  // Allocate the pages for num_objects more objects up front. Ids are
+  // handed out in the same order as with pages allocated on demand.
+  void reserve(uint num_objects);
+
   // Destroy instance of "T", calls destructor
   void destroy(T*);
 
@@ -74,13 +80,20 @@ class dbTable final : public dbObjectTable, public dbIterator
  private:
   void resizePageTbl();
   void newPage();
+  void initPage(uint page_id);
   void pushQ(uint& Q, _dbFreeObject* e);
   _dbFreeObject* popQ(uint& Q);
   void findTop();
   void findBottom();
 
+  // Free list links (next, prev) that differ from the ones in memory.
+  using FreeLinks = std::unordered_map<uint, std::pair<uint, uint>>;
+
   void readPage(dbIStream& stream, dbTablePage* page);
-  void writePage(dbOStream& stream, const dbTablePage* page) const;
+  void writePage(dbOStream& stream,
+                 const dbTablePage* page,
+                 const FreeLinks& links) const;
+  uint trimFreeList(uint page_cnt, FreeLinks& links) const;
 
   _dbFreeObject* getFreeObj(dbId<T> id);
 
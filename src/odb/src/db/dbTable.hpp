@@ -5,6 +5,8 @@
 
 #include <cstring>
 #include <new>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "dbCommon.h"
@@ -162,12 +164,6 @@ void dbTable<T>::resizePageTbl()
 template <class T>
 void dbTable<T>::newPage()
 {
-  const uint size = pageSize() * sizeof(T) + sizeof(dbObjectPage);
-  dbTablePage* page = (dbTablePage*) safe_malloc(size);
-  memset(page, 0, size);
-
-  const uint page_id = _page_cnt;
-
   if (_page_tbl_size == 0) {
     _pages = new dbTablePage*[1];
     _page_tbl_size = 1;
@@ -176,6 +172,18 @@ void dbTable<T>::newPage()
   }
 
   ++_page_cnt;
+  initPage(_page_cnt - 1);
+}
+
+// page_id must already be counted in _page_cnt, as its objects are linked
+// into the free list.
+template <class T>
+void dbTable<T>::initPage(const uint page_id)
+{
+  const uint size = pageSize() * sizeof(T) + sizeof(dbObjectPage);
+  dbTablePage* page = (dbTablePage*) safe_malloc(size);
+  memset(page, 0, size);
+
   page->_table = this;
   page->_page_addr = page_id << _page_shift;
   page->_alloccnt = 0;
@@ -207,6 +215,49 @@ void dbTable<T>::newPage()
   }
 }
 
+template <class T>
+void dbTable<T>::reserve(uint num_objects)
+{
+  // id 0 is never allocated
+  const uint num_slots
+      = (_page_cnt << _page_shift) - (_page_cnt > 0 ? 1 : 0);
+  const uint num_free = num_slots - _alloc_cnt;
+  if (num_objects <= num_free) {
+    return;
+  }
+  const uint num_needed = num_objects - num_free + (_page_cnt == 0 ? 1 : 0);
+  const uint first_page = _page_cnt;
+  const uint end_page = first_page + ((num_needed + _page_mask) >> _page_shift);
+
+  if (_page_tbl_size == 0) {
+    _pages = new dbTablePage*[1];
+    _page_tbl_size = 1;
+  }
+  while (_page_tbl_size < end_page) {
+    resizePageTbl();
+  }
+
+  // create() hands out the free slots of destroyed objects first and then
+  // the new pages from low to high ids. The new pages are pushed last page
+  // first and chained after the existing free slots to keep that order.
+  const uint free_slots = _free_list;
+  _free_list = 0;
+  _page_cnt = end_page;
+  for (uint page_id = end_page; page_id-- > first_page;) {
+    initPage(page_id);
+  }
+
+  if (free_slots != 0) {
+    _dbFreeObject* tail = getFreeObj(free_slots);
+    while (tail->_next != 0) {
+      tail = getFreeObj(tail->_next);
+    }
+    tail->_next = _free_list;
+    getFreeObj(_free_list)->_prev = tail->getImpl()->getOID();
+    _free_list = free_slots;
+  }
+}
+
 template <class T>
 T* dbTable<T>::create()
 {
@@ -470,12 +521,14 @@ dbObject* dbTable<T>::getObject(uint id, ...)
 }
 
 template <class T>
-void dbTable<T>::writePage(dbOStream& stream, const dbTablePage* page) const
+void dbTable<T>::writePage(dbOStream& stream,
+                           const dbTablePage* page,
+                           const FreeLinks& links) const
 {
-  const T* t = (T*) page->_objects;
-  const T* e = &t[pageSize()];
+  const T* b = (T*) page->_objects;
+  const T* e = &b[pageSize()];
 
-  for (; t < e; t++) {
+  for (const T* t = b; t < e; t++) {
     if (t->_oid & DB_ALLOC_BIT) {
       const char allocated = 1;
       stream << allocated;
@@ -483,13 +536,60 @@ void dbTable<T>::writePage(dbOStream& stream, const dbTablePage* page) const
     } else {
       const char allocated = 0;
       stream << allocated;
-      _dbFreeObject* o = (_dbFreeObject*) t;
-      stream << o->_next;
-      stream << o->_prev;
+      const _dbFreeObject* o = (const _dbFreeObject*) t;
+      uint next = o->_next;
+      uint prev = o->_prev;
+      if (!links.empty()) {
+        auto it = links.find(page->_page_addr + (t - b));
+        if (it != links.end()) {
+          std::tie(next, prev) = it->second;
+        }
+      }
+      stream << next;
+      stream << prev;
     }
   }
 }
 
+// Unlinks the slots on pages page_cnt and up from the free list without
+// changing it. Returns the head of the remaining list; the links of its
+// objects that change are put in links.
+template <class T>
+uint dbTable<T>::trimFreeList(const uint page_cnt, FreeLinks& links) const
+{
+  auto get_links = [this](const uint id) {
+    const uint page = id >> _page_shift;
+    const uint offset = id & _page_mask;
+    const _dbFreeObject* o
+        = (const _dbFreeObject*) &(_pages[page]->_objects[offset * sizeof(T)]);
+    return std::make_pair(o->_next, o->_prev);
+  };
+  auto new_links = [&](const uint id) -> std::pair<uint, uint>& {
+    return links.try_emplace(id, get_links(id)).first->second;
+  };
+
+  uint head = 0;
+  uint last = 0;
+  for (uint id = _free_list; id != 0; id = get_links(id).first) {
+    if ((id >> _page_shift) >= page_cnt) {
+      continue;
+    }
+    if (last == 0) {
+      head = id;
+    } else if (get_links(last).first != id) {
+      new_links(last).first = id;
+    }
+    if (get_links(id).second != last) {
+      new_links(id).second = last;
+    }
+    last = id;
+  }
+  if (last != 0 && get_links(last).first != 0) {
+    new_links(last).first = 0;
+  }
+  return head;
+}
+
 template <class T>
 void dbTable<T>::readPage(dbIStream& stream, dbTablePage* page)
 {
@@ -533,18 +633,30 @@ dbOStream& operator<<(dbOStream& stream, const NamedTable<T>& named_table)
 template <class T>
 dbOStream& operator<<(dbOStream& stream, const dbTable<T>& table)
 {
+  // Pages past the last allocated object hold only free slots, such as the
+  // unused part of a reserve(), so they are not written.
+  const uint page_cnt
+      = table._alloc_cnt == 0 ? 0 : (table._top_idx >> table._page_shift) + 1;
+  typename dbTable<T>::FreeLinks links;
+  uint free_list = table._free_list;
+  if (page_cnt == 0) {
+    free_list = 0;
+  } else if (page_cnt < table._page_cnt) {
+    free_list = table.trimFreeList(page_cnt, links);
+  }
+
   stream << table._page_mask;
   stream << table._page_shift;
   stream << table._top_idx;
   stream << table._bottom_idx;
-  stream << table._page_cnt;
+  stream << page_cnt;
   stream << table._page_tbl_size;
   stream << table._alloc_cnt;
-  stream << table._free_list;
+  stream << free_list;
 
-  for (uint i = 0; i < table._page_cnt; ++i) {
+  for (uint i = 0; i < page_cnt; ++i) {
     const dbTablePage* page = table._pages[i];
-    table.writePage(stream, page);
+    table.writePage(stream, page, links);
   }
 
   stream << table._prop_list;
@@ -606,16 +718,12 @@ bool dbTable<T>::operator==(const dbTable<T>& rhs) const
   assert(lhs._page_mask == rhs._page_mask);
   assert(lhs._page_shift == rhs._page_shift);
 
-  // empty tables
-  if ((lhs._page_cnt == 0) && (rhs._page_cnt == 0)) {
+  // empty tables; pages without objects are not compared, as they are not
+  // written
+  if ((lhs._alloc_cnt == 0) && (rhs._alloc_cnt == 0)) {
     return true;
   }
 
-  // Simple rejection test
-  if (lhs._page_cnt != rhs._page_cnt) {
-    return false;
-  }
-
   // Simple rejection test
   if (lhs._bottom_idx != rhs._bottom_idx) {
     return false;
@@ -3,6 +3,7 @@
 
 #include "dbTech.h"
 
+#include <ostream>
 #include <vector>
 
 #include "dbBox.h"
@@ -532,6 +533,13 @@ int dbTech::getDbUnitsPerMicron()
   return tech->_dbu_per_micron;
 }
 
+void dbTech::write(std::ostream& file)
+{
+  _dbTech* tech = (_dbTech*) this;
+  dbOStream stream(tech->getDatabase(), file);
+  stream << *tech;
+}
+
 dbSet<dbTechVia> dbTech::getVias()
 {
   _dbTech* tech = (_dbTech*) this;
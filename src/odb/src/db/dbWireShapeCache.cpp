@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#include "dbWireShapeCache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbShape.h"
+
+namespace odb {
+
+static void addShape(dbWireShapes& shapes, const dbShape& shape, uint net_id)
+{
+  dbTechVia* tech_via = shape.getTechVia();
+  dbVia* via = shape.getVia();
+  shapes.layer.push_back(shape.getTechLayer()->getNumber());
+  shapes.xlo.push_back(shape.xMin());
+  shapes.ylo.push_back(shape.yMin());
+  shapes.xhi.push_back(shape.xMax());
+  shapes.yhi.push_back(shape.yMax());
+  shapes.net_id.push_back(net_id);
+  shapes.via_id.push_back(via ? via->getId() : 0);
+  shapes.tech_via_id.push_back(tech_via ? tech_via->getId() : 0);
+}
+
+template <typename T>
+static void copyField(const std::vector<T>& src, std::vector<T>& dst, size_t at)
+{
+  std::copy(src.begin(), src.end(), dst.begin() + at);
+}
+
+dbWireShapeCache::dbWireShapeCache(dbBlock* block)
+    : _block(block), _valid(false)
+{
+  addOwner(block);
+}
+
+const dbWireShapes& dbWireShapeCache::getShapes(int num_threads)
+{
+  if (!_valid) {
+    build(num_threads);
+    _valid = true;
+  }
+  return _shapes;
+}
+
+void dbWireShapeCache::build(int num_threads)
+{
+  std::vector<dbWire*> wires;
+  std::vector<uint> net_ids;
+  for (dbNet* net : _block->getNets()) {
+    dbWire* wire = net->getWire();
+    if (wire) {
+      wires.push_back(wire);
+      net_ids.push_back(net->getId());
+    }
+  }
+
+  // Decode each wire into its own arrays, then concatenate them in net order.
+  const int num_wires = wires.size();
+  std::vector<dbWireShapes> wire_shapes(num_wires);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+  for (int i = 0; i < num_wires; i++) {
+    dbWireShapes& shapes = wire_shapes[i];
+    dbWireShapeItr itr;
+    dbShape shape;
+    std::vector<dbShape> via_boxes;
+    for (itr.begin(wires[i]); itr.next(shape);) {
+      if (shape.isVia()) {
+        dbShape::getViaBoxes(shape, via_boxes);
+        for (const dbShape& box : via_boxes) {
+          addShape(shapes, box, net_ids[i]);
+        }
+      } else {
+        addShape(shapes, shape, net_ids[i]);
+      }
+    }
+  }
+
+  std::vector<size_t> offsets(num_wires + 1, 0);
+  for (int i = 0; i < num_wires; i++) {
+    offsets[i + 1] = offsets[i] + wire_shapes[i].size();
+  }
+
+  _shapes.resize(offsets[num_wires]);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+  for (int i = 0; i < num_wires; i++) {
+    const dbWireShapes& shapes = wire_shapes[i];
+    const size_t at = offsets[i];
+    copyField(shapes.layer, _shapes.layer, at);
+    copyField(shapes.xlo, _shapes.xlo, at);
+    copyField(shapes.ylo, _shapes.ylo, at);
+    copyField(shapes.xhi, _shapes.xhi, at);
+    copyField(shapes.yhi, _shapes.yhi, at);
+    copyField(shapes.net_id, _shapes.net_id, at);
+    copyField(shapes.via_id, _shapes.via_id, at);
+    copyField(shapes.tech_via_id, _shapes.tech_via_id, at);
+  }
+}
+
+}  // namespace odb
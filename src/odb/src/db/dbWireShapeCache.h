@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#pragma once
+
+#include "odb/dbBlockCallBackObj.h"
+#include "odb/dbShape.h"
+
+namespace odb {
+
+class dbBlock;
+class dbNet;
+class dbWire;
+
+//
+// Cached dbWireShapes of a block, dropped whenever a wire callback fires.
+//
+class dbWireShapeCache : public dbBlockCallBackObj
+{
+ public:
+  dbWireShapeCache(dbBlock* block);
+
+  const dbWireShapes& getShapes(int num_threads);
+
+  void inDbWireCreate(dbWire*) override { _valid = false; }
+  void inDbWireDestroy(dbWire*) override { _valid = false; }
+  void inDbWirePostModify(dbWire*) override { _valid = false; }
+  void inDbWirePostAttach(dbWire*) override { _valid = false; }
+  void inDbWirePostDetach(dbWire*, dbNet*) override { _valid = false; }
+  void inDbWirePostAppend(dbWire*, dbWire*) override { _valid = false; }
+  void inDbWirePostCopy(dbWire*, dbWire*) override { _valid = false; }
+
+ private:
+  void build(int num_threads);
+
+  dbBlock* _block;
+  dbWireShapes _shapes;
+  bool _valid;
+};
+
+}  // namespace odb
@@ -264,6 +264,31 @@ void definReader::init()
     (*itr)->setMode(_mode);
   }
   _update = false;
+  _reserved_nets = 0;
+}
+
+// A net listed in both NETS and SPECIALNETS, or already created for a PIN,
+// is only created once.  The sum of the two section counts bounds the nets
+// of the block, so each section only reserves what that bound adds beyond
+// the nets that exist, and the table is not sized twice for the same nets.
+void definReader::reserveNets(const char* section, int number)
+{
+  if (_mode != defin::DEFAULT || number <= 0) {
+    return;
+  }
+  _reserved_nets += number;
+  const uint num_nets = _block->getNets().size();
+  if (_reserved_nets <= num_nets) {
+    return;
+  }
+  debugPrint(_logger,
+             utl::ODB,
+             "defin",
+             1,
+             "{}: reserving {} objects",
+             section,
+             _reserved_nets - num_nets);
+  _block->reserveNets(_reserved_nets - num_nets);
 }
 
 void definReader::setTech(dbTech* tech)
@@ -504,6 +529,27 @@ int definReader::blockageCallback(
   return PARSE_OK;
 }
 
+int definReader::componentsStartCallback(
+    DefParser::defrCallbackType_e /* unused: type */,
+    int number,
+    DefParser::defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  // Size the name table from the section count up front rather than
+  // rehashing it repeatedly as the components are created.
+  if (reader->_mode == defin::DEFAULT && number > 0) {
+    debugPrint(reader->_logger,
+               utl::ODB,
+               "defin",
+               1,
+               "COMPONENTS: reserving {} objects",
+               number);
+    reader->_block->reserveInsts(number);
+  }
+  return PARSE_OK;
+}
+
 int definReader::componentsCallback(
     DefParser::defrCallbackType_e /* unused: type */,
     DefParser::defiComponent* comp,
@@ -731,6 +777,17 @@ int definReader::historyCallback(
   return PARSE_OK;
 }
 
+int definReader::netsStartCallback(
+    DefParser::defrCallbackType_e /* unused: type */,
+    int number,
+    DefParser::defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  reader->reserveNets("NETS", number);
+  return PARSE_OK;
+}
+
 int definReader::netCallback(DefParser::defrCallbackType_e /* unused: type */,
                              DefParser::defiNet* net,
                              DefParser::defiUserData data)
@@ -1623,6 +1680,17 @@ int definReader::viaCallback(DefParser::defrCallbackType_e /* unused: type */,
   return PARSE_OK;
 }
 
+int definReader::specialNetsStartCallback(
+    DefParser::defrCallbackType_e /* unused: type */,
+    int number,
+    DefParser::defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  reader->reserveNets("SPECIALNETS", number);
+  return PARSE_OK;
+}
+
 int definReader::specialNetCallback(
     DefParser::defrCallbackType_e /* unused: type */,
     DefParser::defiNet* net,
@@ -2021,6 +2089,9 @@ bool definReader::createBlock(const char* file)
   }
 
   if (_mode == defin::DEFAULT) {
+    defrSetComponentStartCbk(componentsStartCallback);
+    defrSetNetStartCbk(netsStartCallback);
+    defrSetSNetStartCbk(specialNetsStartCallback);
     defrSetPropCbk(propCallback);
     defrSetPropDefEndCbk(propEndCallback);
     defrSetPropDefStartCbk(propStartCallback);
@@ -73,6 +73,7 @@ class definReader : public definBase
 
   bool createBlock(const char* file);
   int errors();
+  void reserveNets(const char* section, int number);
 
   // Parser callbacks
   static int blockageCallback(DefParser::defrCallbackType_e type,
@@ -83,6 +84,9 @@ class definReader : public definBase
                                 DefParser::defiComponent* comp,
                                 DefParser::defiUserData data);
 
+  static int componentsStartCallback(DefParser::defrCallbackType_e type,
+                                     int number,
+                                     DefParser::defiUserData data);
   static int componentMaskShiftCallback(
       DefParser::defrCallbackType_e type,
       DefParser::defiComponentMaskShiftLayer* shiftLayers,
@@ -127,6 +131,9 @@ class definReader : public definBase
                          DefParser::defiNet* net,
                          DefParser::defiUserData data);
 
+  static int netsStartCallback(DefParser::defrCallbackType_e type,
+                               int number,
+                               DefParser::defiUserData data);
   static int nonDefaultRuleCallback(DefParser::defrCallbackType_e type,
                                     DefParser::defiNonDefault* rule,
                                     DefParser::defiUserData data);
@@ -177,6 +184,9 @@ class definReader : public definBase
                            int count,
                            DefParser::defiUserData data);
 
+  static int specialNetsStartCallback(DefParser::defrCallbackType_e type,
+                                      int number,
+                                      DefParser::defiUserData data);
   static int specialNetCallback(DefParser::defrCallbackType_e type,
                                 DefParser::defiNet* net,
                                 DefParser::defiUserData data);
@@ -244,6 +254,7 @@ class definReader : public definBase
   std::vector<definBase*> _interfaces;
   bool _update{false};
   bool _continue_on_errors{false};
+  uint _reserved_nets{0};
   std::string _block_name;
   std::string version_;
   char hier_delimiter_{0};
@@ -46,6 +46,11 @@ void defout::setVersion(Version v)
   _writer->setVersion(v);
 }
 
+void defout::setNumThreads(int threads)
+{
+  _writer->setNumThreads(threads);
+}
+
 bool defout::writeBlock(dbBlock* block, const char* def_file)
 {
   return _writer->writeBlock(block, def_file);
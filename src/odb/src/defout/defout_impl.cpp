@@ -12,6 +12,7 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -1404,34 +1405,69 @@ void defout_impl::writeNets(dbBlock* block)
     }
   }
 
-  if (snet_cnt > 0) {
-    *_out << "SPECIALNETS " << snet_cnt << " ;\n";
-
-    for (dbNet* net : sorted_nets) {
-      if (_select_net_map && !(*_select_net_map)[net]) {
-        continue;
-      }
-      if (net->isSpecial()) {
-        writeSNet(net);
-      }
+  std::vector<dbNet*> special_nets;
+  std::vector<dbNet*> regular_nets;
+  regular_nets.reserve(net_cnt);
+  for (dbNet* net : sorted_nets) {
+    if (_select_net_map && !(*_select_net_map)[net]) {
+      continue;
+    }
+    if (net->isSpecial()) {
+      special_nets.push_back(net);
+    }
+    if (regular_net[net] == 1) {
+      regular_nets.push_back(net);
     }
+  }
 
+  if (snet_cnt > 0) {
+    *_out << "SPECIALNETS " << snet_cnt << " ;\n";
+    writeNetList(special_nets, &defout_impl::writeSNet);
     *_out << "END SPECIALNETS\n";
   }
 
   *_out << "NETS " << net_cnt << " ;\n";
+  writeNetList(regular_nets, &defout_impl::writeNet);
+  *_out << "END NETS\n";
+}
 
-  for (dbNet* net : sorted_nets) {
-    if (_select_net_map && !(*_select_net_map)[net]) {
-      continue;
+// Decoding wires dominates the cost of writing nets, so with more than one
+// thread each net is formatted into its own buffer by a copy of the writer
+// made once per thread. Buffers are emitted in net order a batch at a time
+// so the output matches the sequential writer and memory stays bounded.
+void defout_impl::writeNetList(const std::vector<dbNet*>& nets,
+                               void (defout_impl::*write_net)(dbNet*))
+{
+  const int net_count = nets.size();
+  if (_num_threads <= 1 || net_count < 2) {
+    for (dbNet* net : nets) {
+      (this->*write_net)(net);
     }
+    return;
+  }
 
-    if (regular_net[net] == 1) {
-      writeNet(net);
+  const int batch_size = 8192;
+  std::vector<std::string> net_text(std::min(batch_size, net_count));
+#pragma omp parallel num_threads(_num_threads)
+  {
+    defout_impl writer(*this);
+    std::ostringstream buffer;
+    writer._out = &buffer;
+    for (int batch_begin = 0; batch_begin < net_count;
+         batch_begin += batch_size) {
+      const int batch_end = std::min(batch_begin + batch_size, net_count);
+#pragma omp for schedule(dynamic, 16)
+      for (int i = batch_begin; i < batch_end; i++) {
+        buffer.str("");
+        (writer.*write_net)(nets[i]);
+        net_text[i - batch_begin] = buffer.str();
+      }
+#pragma omp single
+      for (int i = batch_begin; i < batch_end; i++) {
+        *_out << net_text[i - batch_begin];
+      }
     }
   }
-
-  *_out << "END NETS\n";
 }
 
 void defout_impl::writeSNet(dbNet* net)
@@ -7,6 +7,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -50,6 +51,7 @@ class defout_impl
   dbMap<dbInst, char>* _select_inst_map;
   dbTechNonDefaultRule* _non_default_rule;
   int _version;
+  int _num_threads;
   std::map<std::string, bool> _prop_defs[9];
   utl::Logger* _logger;
 
@@ -78,6 +80,8 @@ class defout_impl
   void writeBlockages(dbBlock* block);
   void writeFills(dbBlock* block);
   void writeNets(dbBlock* block);
+  void writeNetList(const std::vector<dbNet*>& nets,
+                    void (defout_impl::*write_net)(dbNet*));
   void writeNet(dbNet* net);
   void writeSNet(dbNet* net);
   void writeWire(dbWire* wire);
@@ -100,6 +104,7 @@ class defout_impl
     _select_inst_map = nullptr;
     _non_default_rule = nullptr;
     _version = defout::DEF_5_8;
+    _num_threads = 1;
     _logger = logger;
   }
 
@@ -115,6 +120,7 @@ class defout_impl
 
   void selectInst(dbInst* inst);
   void setVersion(int v) { _version = v; }
+  void setNumThreads(int threads) { _num_threads = threads; }
 
   bool writeBlock(dbBlock* block, const char* def_file);
   bool writeBlock(dbBlock* block, std::ostream& stream);
@@ -3,8 +3,12 @@
 
 #include "odb/gdsin.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -16,20 +20,34 @@ GDSReader::GDSReader(utl::Logger* logger) : _logger(logger)
 {
 }
 
-dbGDSLib* GDSReader::read_gds(const std::string& filename, dbDatabase* db)
+dbGDSLib* GDSReader::read_gds(const std::string& filename,
+                              dbDatabase* db,
+                              const std::string& top_cell)
 {
   _db = db;
-  _file.open(filename, std::ios::binary);
-  if (!_file) {
+  try {
+    _file.open(filename);
+  } catch (const std::exception&) {
     _logger->error(ODB, 450, "Could not open file {}", filename);
   }
+  // The dbGDSLib does not point into the mapping, so unmap the file as
+  // soon as the read ends, including when a corrupt record stops it.
+  struct FileCloser
+  {
+    boost::iostreams::mapped_file_source& file;
+    ~FileCloser()
+    {
+      if (file.is_open()) {
+        file.close();
+      }
+    }
+  } closer{_file};
+  _pos = 0;
+  _top_cell = top_cell;
   readRecord();
   checkRType(RecordType::HEADER);
 
   processLib();
-  if (_file.is_open()) {
-    _file.close();
-  }
   _db = nullptr;
 
   return _lib;
@@ -57,31 +75,42 @@ void GDSReader::checkRData(DataType eType, size_t eSize)
   }
 }
 
+void GDSReader::readBytes(void* dst, const size_t size)
+{
+  if (_pos + size > _file.size()) {
+    _pos = _file.size() + 1;
+    std::memset(dst, 0, size);
+    return;
+  }
+  std::memcpy(dst, _file.data() + _pos, size);
+  _pos += size;
+}
+
 double GDSReader::readReal8()
 {
   uint64_t value;
-  _file.read(reinterpret_cast<char*>(&value), 8);
+  readBytes(&value, 8);
   return real8_to_double(htobe64(value));
 }
 
 int32_t GDSReader::readInt32()
 {
   int32_t value;
-  _file.read(reinterpret_cast<char*>(&value), 4);
+  readBytes(&value, 4);
   return htobe32(value);
 }
 
 int16_t GDSReader::readInt16()
 {
   int16_t value;
-  _file.read(reinterpret_cast<char*>(&value), 2);
+  readBytes(&value, 2);
   return htobe16(value);
 }
 
 int8_t GDSReader::readInt8()
 {
   int8_t value;
-  _file.read(reinterpret_cast<char*>(&value), 1);
+  readBytes(&value, 1);
   return value;
 }
 
@@ -115,13 +144,33 @@ bool GDSReader::readRecord()
     }
   } else if (dataType == DataType::ASCII_STRING
              || dataType == DataType::BIT_ARRAY) {
-    _r.data8.clear();
-    for (int i = 0; i < length; i++) {
-      _r.data8.push_back(readInt8());
-    }
+    _r.data8.resize(length);
+    readBytes(_r.data8.data(), length);
   }
 
-  return static_cast<bool>(_file);
+  return _pos <= _file.size();
+}
+
+bool GDSReader::skipRecord(RecordType& type, std::string& data8)
+{
+  const uint16_t recordLength = readInt16();
+  type = toRecordType(readInt8());
+  readInt8();
+  if (_pos > _file.size() || recordLength < 4) {
+    return false;
+  }
+  const size_t length = recordLength - 4;
+  if (type == RecordType::STRNAME || type == RecordType::SNAME) {
+    data8.resize(length);
+    readBytes(data8.data(), length);
+    // odd length names are padded to an even length with a NUL
+    while (!data8.empty() && data8.back() == '\0') {
+      data8.pop_back();
+    }
+  } else {
+    _pos += length;
+  }
+  return _pos <= _file.size();
 }
 
 bool GDSReader::processLib()
@@ -145,6 +194,10 @@ bool GDSReader::processLib()
 
   _lib->setUnits(_r.data64[0], _r.data64[1]);
 
+  if (!_top_cell.empty()) {
+    return processTopCell();
+  }
+
   while (readRecord()) {
     if (_r.type == RecordType::ENDLIB) {
       return true;
@@ -160,6 +213,87 @@ bool GDSReader::processLib()
   return false;
 }
 
+bool GDSReader::processTopCell()
+{
+  // Index every structure by only decoding record headers and names, then
+  // parse just the structures reachable from the top cell.
+  struct StructIndex
+  {
+    size_t offset;
+    std::vector<std::string> refs;
+  };
+  std::map<std::string, StructIndex> index;
+  std::string name;
+  RecordType type;
+  bool found_end = false;
+  while (skipRecord(type, name)) {
+    if (type == RecordType::ENDLIB) {
+      found_end = true;
+      break;
+    }
+    if (type != RecordType::BGNSTR) {
+      continue;
+    }
+    const size_t offset = _pos;
+    if (!skipRecord(type, name) || type != RecordType::STRNAME) {
+      break;
+    }
+    if (index.find(name) != index.end()) {
+      throw std::runtime_error("Corrupted GDS, Duplicate structure name");
+    }
+    StructIndex& entry = index[name];
+    entry.offset = offset;
+    while (skipRecord(type, name) && type != RecordType::ENDSTR) {
+      if (type == RecordType::SNAME) {
+        entry.refs.push_back(name);
+      }
+    }
+  }
+  if (!found_end) {
+    _lib = nullptr;
+    return false;
+  }
+
+  if (index.find(_top_cell) == index.end()) {
+    _logger->error(ODB, 1115, "Top cell {} not found in GDS", _top_cell);
+  }
+
+  std::set<std::string> reachable{_top_cell};
+  std::deque<std::string> queue{_top_cell};
+  while (!queue.empty()) {
+    auto it = index.find(queue.front());
+    queue.pop_front();
+    if (it == index.end()) {
+      continue;
+    }
+    for (const std::string& ref : it->second.refs) {
+      if (reachable.insert(ref).second) {
+        queue.push_back(ref);
+      }
+    }
+  }
+
+  // Parse in file order so structures are created in the same order as a
+  // full read.
+  std::vector<size_t> offsets;
+  for (const std::string& str_name : reachable) {
+    auto it = index.find(str_name);
+    if (it != index.end()) {
+      offsets.push_back(it->second.offset);
+    }
+  }
+  std::sort(offsets.begin(), offsets.end());
+  for (const size_t offset : offsets) {
+    _pos = offset;
+    if (!processStruct()) {
+      _lib = nullptr;
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool GDSReader::processStruct()
 {
   readRecord();
@@ -3,6 +3,12 @@
 
 #include "odb/gdsout.h"
 
+#include <algorithm>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <ctime>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -15,20 +21,52 @@ GDSWriter::GDSWriter(utl::Logger* logger) : _logger(logger)
 {
 }
 
-void GDSWriter::write_gds(dbGDSLib* lib, const std::string& filename)
+void GDSWriter::write_gds(dbGDSLib* lib,
+                          const std::string& filename,
+                          const int num_threads)
 {
-  _lib = lib;
-  _file.open(filename, std::ios::binary);
-  if (!_file) {
+  std::ofstream file(filename, std::ios::binary);
+  if (!file) {
     _logger->error(ODB, 447, "Could not open file {}", filename);
   }
-  writeLib();
-  if (_file.is_open()) {
-    _file.close();
+  std::vector<char> file_buffer(1 << 20);
+  file.rdbuf()->pubsetbuf(file_buffer.data(), file_buffer.size());
+
+  boost::iostreams::filtering_ostream out;
+  if (boost::ends_with(filename, ".gz")) {
+    out.push(boost::iostreams::gzip_compressor());
   }
+  out.push(file);
+
+  _lib = lib;
+  setTimestamp();
+  writeLib(out, num_threads);
+  out.reset();
+  file.close();
   _lib = nullptr;
 }
 
+void GDSWriter::setTimestamp()
+{
+  // All structures share the library's timestamp so that the output does not
+  // depend on how long encoding takes or on which thread encodes a structure.
+  const std::time_t now = std::time(nullptr);
+  std::tm lt;
+  localtime_r(&now, &lt);
+  _timestamp = {(int16_t) lt.tm_year,
+                (int16_t) lt.tm_mon,
+                (int16_t) lt.tm_mday,
+                (int16_t) lt.tm_hour,
+                (int16_t) lt.tm_min,
+                (int16_t) lt.tm_sec,
+                (int16_t) lt.tm_year,
+                (int16_t) lt.tm_mon,
+                (int16_t) lt.tm_mday,
+                (int16_t) lt.tm_hour,
+                (int16_t) lt.tm_min,
+                (int16_t) lt.tm_sec};
+}
+
 void GDSWriter::calcRecSize(record_t& r)
 {
   r.length = 4;
@@ -58,24 +96,24 @@ void GDSWriter::calcRecSize(record_t& r)
 void GDSWriter::writeReal8(double real)
 {
   const uint64_t value = htobe64(double_to_real8(real));
-  _file.write(reinterpret_cast<const char*>(&value), sizeof(uint64_t));
+  _buffer->append(reinterpret_cast<const char*>(&value), sizeof(uint64_t));
 }
 
 void GDSWriter::writeInt32(int32_t i)
 {
   const int32_t value = htobe32(i);
-  _file.write(reinterpret_cast<const char*>(&value), sizeof(int32_t));
+  _buffer->append(reinterpret_cast<const char*>(&value), sizeof(int32_t));
 }
 
 void GDSWriter::writeInt16(int16_t i)
 {
   const int16_t value = htobe16(i);
-  _file.write(reinterpret_cast<const char*>(&value), sizeof(int16_t));
+  _buffer->append(reinterpret_cast<const char*>(&value), sizeof(int16_t));
 }
 
 void GDSWriter::writeInt8(int8_t i)
 {
-  _file.write(reinterpret_cast<const char*>(&i), sizeof(int8_t));
+  _buffer->push_back(static_cast<char>(i));
 }
 
 void GDSWriter::writeRecord(record_t& r)
@@ -106,7 +144,7 @@ void GDSWriter::writeRecord(record_t& r)
     }
     case DataType::ASCII_STRING:
     case DataType::BIT_ARRAY: {
-      _file.write(r.data8.c_str(), r.data8.size());
+      _buffer->append(r.data8);
       break;
     }
     case DataType::NO_DATA: {
@@ -119,8 +157,11 @@ void GDSWriter::writeRecord(record_t& r)
   }
 }
 
-void GDSWriter::writeLib()
+void GDSWriter::writeLib(std::ostream& out, const int num_threads)
 {
+  std::string header;
+  _buffer = &header;
+
   record_t rh;
   rh.type = RecordType::HEADER;
   rh.dataType = DataType::INT_2;
@@ -130,21 +171,7 @@ void GDSWriter::writeLib()
   record_t r;
   r.type = RecordType::BGNLIB;
   r.dataType = DataType::INT_2;
-
-  const std::time_t now = std::time(nullptr);
-  const std::tm* lt = std::localtime(&now);
-  r.data16 = {(int16_t) lt->tm_year,
-              (int16_t) lt->tm_mon,
-              (int16_t) lt->tm_mday,
-              (int16_t) lt->tm_hour,
-              (int16_t) lt->tm_min,
-              (int16_t) lt->tm_sec,
-              (int16_t) lt->tm_year,
-              (int16_t) lt->tm_mon,
-              (int16_t) lt->tm_mday,
-              (int16_t) lt->tm_hour,
-              (int16_t) lt->tm_min,
-              (int16_t) lt->tm_sec};
+  r.data16 = _timestamp;
   writeRecord(r);
 
   record_t r2;
@@ -161,15 +188,54 @@ void GDSWriter::writeLib()
   r3.data64 = {units.first, units.second};
   writeRecord(r3);
 
-  auto structures = _lib->getGDSStructures();
-  for (auto s : structures) {
-    writeStruct(s);
+  out.write(header.data(), header.size());
+
+  std::vector<dbGDSStructure*> structures;
+  for (auto s : _lib->getGDSStructures()) {
+    structures.push_back(s);
   }
+  writeStructs(out, structures, num_threads);
+
+  std::string footer;
+  _buffer = &footer;
 
   record_t r4;
   r4.type = RecordType::ENDLIB;
   r4.dataType = DataType::NO_DATA;
   writeRecord(r4);
+
+  out.write(footer.data(), footer.size());
+  _buffer = nullptr;
+}
+
+void GDSWriter::writeStructs(std::ostream& out,
+                             const std::vector<dbGDSStructure*>& structures,
+                             const int num_threads)
+{
+  // Structures are independent, so each one is encoded into its own buffer
+  // by a private writer. Buffers are written in library order a batch at a
+  // time to bound memory use.
+  const int num_structs = structures.size();
+  const int batch_size = std::max(num_threads, 1) * 4;
+  std::vector<std::string> buffers(std::min(batch_size, num_structs));
+  for (int batch_begin = 0; batch_begin < num_structs;
+       batch_begin += batch_size) {
+    const int batch_end = std::min(batch_begin + batch_size, num_structs);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (int i = batch_begin; i < batch_end; i++) {
+      GDSWriter encoder(_logger);
+      encoder._lib = _lib;
+      encoder._timestamp = _timestamp;
+      std::string& buffer = buffers[i - batch_begin];
+      buffer.clear();
+      encoder._buffer = &buffer;
+      encoder.writeStruct(structures[i]);
+    }
+    for (int i = batch_begin; i < batch_end; i++) {
+      const std::string& buffer = buffers[i - batch_begin];
+      out.write(buffer.data(), buffer.size());
+    }
+  }
 }
 
 void GDSWriter::writeStruct(dbGDSStructure* str)
@@ -177,21 +243,7 @@ void GDSWriter::writeStruct(dbGDSStructure* str)
   record_t r;
   r.type = RecordType::BGNSTR;
   r.dataType = DataType::INT_2;
-
-  std::time_t now = std::time(nullptr);
-  std::tm* lt = std::localtime(&now);
-  r.data16 = {(int16_t) lt->tm_year,
-              (int16_t) lt->tm_mon,
-              (int16_t) lt->tm_mday,
-              (int16_t) lt->tm_hour,
-              (int16_t) lt->tm_min,
-              (int16_t) lt->tm_sec,
-              (int16_t) lt->tm_year,
-              (int16_t) lt->tm_mon,
-              (int16_t) lt->tm_mday,
-              (int16_t) lt->tm_hour,
-              (int16_t) lt->tm_min,
-              (int16_t) lt->tm_sec};
+  r.data16 = _timestamp;
   writeRecord(r);
 
   record_t r2;
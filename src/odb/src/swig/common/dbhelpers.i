@@ -19,6 +19,10 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path);
 
 int write_db(odb::dbDatabase* db, const char* db_path);
 
+odb::dbGDSLib* read_gds(odb::dbDatabase* db, const char* path);
+
+int write_gds(odb::dbGDSLib* lib, const char* path, int num_threads = 1);
+
 void createSBoxes(odb::dbSWire* swire,
                   odb::dbTechLayer* layer,
                   std::vector<odb::Rect> rects,
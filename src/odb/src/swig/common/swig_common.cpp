@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "odb/defin.h"
+#include "odb/gdsin.h"
+#include "odb/gdsout.h"
 #include "odb/lefin.h"
 #include "odb/lefout.h"
 #include "utl/Logger.h"
@@ -117,6 +119,21 @@ int write_db(odb::dbDatabase* db, const char* db_path)
   return 1;
 }
 
+odb::dbGDSLib* read_gds(odb::dbDatabase* db, const char* path)
+{
+  utl::Logger* logger = new utl::Logger(nullptr);
+  odb::gds::GDSReader reader(logger);
+  return reader.read_gds(path, db);
+}
+
+int write_gds(odb::dbGDSLib* lib, const char* path, int num_threads)
+{
+  utl::Logger* logger = new utl::Logger(nullptr);
+  odb::gds::GDSWriter writer(logger);
+  writer.write_gds(lib, path, num_threads);
+  return 1;
+}
+
 int writeEco(odb::dbBlock* block, const char* filename)
 {
   odb::dbDatabase::writeEco(block, filename);
@@ -26,6 +26,10 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path);
 
 int write_db(odb::dbDatabase* db, const char* db_path);
 
+odb::dbGDSLib* read_gds(odb::dbDatabase* db, const char* path);
+
+int write_gds(odb::dbGDSLib* lib, const char* path, int num_threads = 1);
+
 int writeEco(odb::dbBlock* block, const char* filename);
 
 int readEco(odb::dbBlock* block, const char* filename);
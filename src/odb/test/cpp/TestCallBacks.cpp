@@ -1,6 +1,8 @@
 #define BOOST_TEST_MODULE TestCallbacks
 #include <boost/test/included/unit_test.hpp>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "CallBack.h"
 #include "helper.h"
@@ -101,6 +103,61 @@ BOOST_AUTO_TEST_CASE(test_net)
   BOOST_TEST(cb->events[0] == "Destroy net n1");
   tearDown();
 }
+BOOST_AUTO_TEST_CASE(test_bulk_create)
+{
+  setup();
+  db = createSimpleDB();
+  block = db->getChip()->getBlock();
+  dbNet::create(block, "n1");
+  cb->addOwner(block);
+  std::vector<dbNet*> nets = dbNet::create(block, {"n2", "n1", "n3"});
+  BOOST_TEST(nets.size() == 3);
+  BOOST_TEST(nets[1] == nullptr);
+  BOOST_TEST(nets[0]->getId() < nets[2]->getId());
+  BOOST_TEST(cb->events.size() == 2);
+  BOOST_TEST(cb->events[0] == "Create net n2");
+  BOOST_TEST(cb->events[1] == "Create net n3");
+  cb->clearEvents();
+  std::vector<dbInst*> insts
+      = dbInst::create(block, db->findMaster("and2"), {"i1", "i2"});
+  BOOST_TEST(insts.size() == 2);
+  BOOST_TEST(block->findInst("i2") == insts[1]);
+  BOOST_TEST(insts[1]->getITerms().size() == 3);
+  BOOST_TEST(cb->events.size() == 8);
+  BOOST_TEST(cb->events[0] == "Create inst i1");
+  BOOST_TEST(cb->events[3] == "Create iterm o of inst i1");
+  BOOST_TEST(cb->events[4] == "Create inst i2");
+  tearDown();
+}
+BOOST_AUTO_TEST_CASE(test_reserve_keeps_id_order)
+{
+  // Preallocated pages must hand out the same ids as pages allocated on
+  // demand, including the slots freed by destroyed objects.
+  auto create_nets = [](bool reserve) {
+    dbDatabase* db = createSimpleDB();
+    dbBlock* block = db->getChip()->getBlock();
+    std::vector<dbNet*> nets;
+    for (int i = 0; i < 5; i++) {
+      nets.push_back(dbNet::create(block, ("a" + std::to_string(i)).c_str()));
+    }
+    dbNet::destroy(nets[1]);
+    dbNet::destroy(nets[3]);
+    if (reserve) {
+      block->reserveNets(300);
+    }
+    std::vector<uint> ids;
+    for (int i = 0; i < 300; i++) {
+      dbNet* net = dbNet::create(block, ("b" + std::to_string(i)).c_str());
+      ids.push_back(net->getId());
+    }
+    BOOST_TEST(block->findNet("b299")->getId() == ids.back());
+    dbDatabase::destroy(db);
+    return ids;
+  };
+  const std::vector<uint> on_demand = create_nets(false);
+  const std::vector<uint> reserved = create_nets(true);
+  BOOST_TEST(on_demand == reserved, boost::test_tools::per_element());
+}
 BOOST_AUTO_TEST_CASE(test_bterm)
 {
   setup();
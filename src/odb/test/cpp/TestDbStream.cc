@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2025-2025, The OpenROAD Authors
+
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+void checkReadBack(const std::string& bytes, int num_threads)
+{
+  dbDatabase* db = dbDatabase::create();
+  std::istringstream read(bytes, std::ios::binary);
+  read.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+  db->read(read, num_threads);
+
+  dbBlock* block = db->getChip()->getBlock();
+  EXPECT_EQ(block->getInsts().size(), 3);
+  EXPECT_EQ(block->getNets().size(), 7);
+  EXPECT_NE(block->findInst("i3"), nullptr);
+
+  dbDatabase::destroy(db);
+}
+
+TEST(DbStreamTest, ParallelWriteMatchesSequentialWrite)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+
+  std::ostringstream sequential(std::ios::binary);
+  db->write(sequential);
+
+  std::ostringstream parallel(std::ios::binary);
+  db->write(parallel, 4);
+
+  EXPECT_EQ(sequential.str(), parallel.str());
+  checkReadBack(parallel.str(), 1);
+  checkReadBack(parallel.str(), 4);
+
+  dbDatabase::destroy(db);
+}
+
+TEST(DbStreamTest, CompressedTablesReadBack)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+
+  std::ostringstream sequential(std::ios::binary);
+  db->write(sequential, 1, true);
+
+  std::ostringstream parallel(std::ios::binary);
+  db->write(parallel, 4, true);
+
+  EXPECT_EQ(sequential.str(), parallel.str());
+  checkReadBack(parallel.str(), 1);
+  checkReadBack(parallel.str(), 4);
+
+  dbDatabase::destroy(db);
+}
+
+TEST(DbStreamTest, ReservedPagesAreNotWritten)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+
+  std::ostringstream before(std::ios::binary);
+  db->write(before);
+
+  dbBlock* block = db->getChip()->getBlock();
+  block->reserveNets(10000);
+  std::ostringstream reserved(std::ios::binary);
+  db->write(reserved);
+  dbDatabase::destroy(db);
+
+  // Only the resized name hash table is written, at most one 4 byte bucket
+  // per reserved net; none of the reserved pages of the net table is.
+  EXPECT_LE(reserved.str().size(), before.str().size() + 10000 * sizeof(uint));
+  checkReadBack(reserved.str(), 1);
+
+  // The free list read back still hands out new objects.
+  db = dbDatabase::create();
+  std::istringstream read(reserved.str(), std::ios::binary);
+  db->read(read);
+  block = db->getChip()->getBlock();
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_NE(dbNet::create(block, ("new" + std::to_string(i)).c_str()), nullptr);
+  }
+  EXPECT_EQ(block->getNets().size(), 1007);
+  dbDatabase::destroy(db);
+}
+
+}  // namespace
+}  // namespace odb
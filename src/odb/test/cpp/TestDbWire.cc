@@ -10,6 +10,8 @@
 
 #include "gtest/gtest.h"
 #include "odb/db.h"
+#include "odb/dbShape.h"
+#include "odb/dbShapeIndex.h"
 #include "odb/dbWireCodec.h"
 #include "odb/lefin.h"
 #include "utl/Logger.h"
@@ -135,4 +137,152 @@ TEST_F(OdbMultiPatternedTest, WireColorIsClearedOnNewPath)
   EXPECT_EQ(decoder.getColor().value(), /*mask_color=*/2);
 }
 
+TEST_F(OdbMultiPatternedTest, WireShapesTrackWireChanges)
+{
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+  dbTechLayer* met2 = tech->findLayer("met2");
+  dbTechVia* met1_met2 = tech->findVia("M1M2_PR_MR");
+
+  dbNet* net0 = dbNet::create(block_.get(), "net0");
+  dbWire* wire0 = dbWire::create(net0);
+  dbWireEncoder encoder;
+  encoder.begin(wire0);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(100, 50);
+  encoder.addTechVia(met1_met2);
+  encoder.addPoint(100, 130);
+  encoder.end();
+
+  dbNet* net1 = dbNet::create(block_.get(), "net1");
+  dbWire* wire1 = dbWire::create(net1);
+  encoder.begin(wire1);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 200);
+  encoder.addPoint(300, 200);
+  encoder.end();
+
+  const int via_boxes = met1_met2->getBoxes().size();
+  const dbWireShapes& shapes = block_->getWireShapes(2);
+  ASSERT_EQ(shapes.size(), 3 + via_boxes);
+
+  EXPECT_EQ(shapes.net_id[0], net0->getId());
+  EXPECT_EQ(shapes.layer[0], met1->getNumber());
+  EXPECT_EQ(shapes.via_id[0], 0);
+  EXPECT_EQ(shapes.tech_via_id[0], 0);
+  EXPECT_EQ(shapes.tech_via_id[1], met1_met2->getId());
+  EXPECT_EQ(shapes.layer[1 + via_boxes], met2->getNumber());
+  EXPECT_EQ(shapes.net_id.back(), net1->getId());
+  EXPECT_LT(shapes.ylo.back(), 200);
+  EXPECT_GT(shapes.yhi.back(), 200);
+
+  dbWire::destroy(wire1);
+  EXPECT_EQ(block_->getWireShapes().size(), 2 + via_boxes);
+}
+
+TEST_F(OdbMultiPatternedTest, ShapeIndexTracksWireChanges)
+{
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+  dbTechLayer* met2 = tech->findLayer("met2");
+
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbWire* wire = dbWire::create(net);
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(300, 50);
+  encoder.end();
+
+  const dbShapeIndex* index = block_->getShapeIndex(2);
+  std::vector<dbShapeIndex::RectValue<dbNet*>> shapes;
+  index->findWires(met1, Rect(100, 40, 110, 60), shapes);
+  ASSERT_EQ(shapes.size(), 1);
+  EXPECT_EQ(shapes[0].second, net);
+
+  // Re-encoding the wire moves its shape to met2.
+  encoder.begin(wire);
+  encoder.newPath(met2, dbWireType::ROUTED);
+  encoder.addPoint(50, 500);
+  encoder.addPoint(300, 500);
+  encoder.end();
+
+  shapes.clear();
+  index->findWires(met1, Rect(100, 40, 110, 60), shapes);
+  EXPECT_TRUE(shapes.empty());
+  index->findWires(met2, Rect(100, 490, 110, 510), shapes);
+  ASSERT_EQ(shapes.size(), 1);
+  EXPECT_EQ(shapes[0].second, net);
+
+  dbNet::destroy(net);
+  shapes.clear();
+  index->findWires(met2, Rect(100, 490, 110, 510), shapes);
+  EXPECT_TRUE(shapes.empty());
+
+  block_->releaseShapeIndex();
+}
+
+TEST_F(OdbMultiPatternedTest, ShapeIndexTracksInstsInRegions)
+{
+  dbMaster* master = dbMaster::create(lib_.get(), "cell");
+  master->setWidth(100);
+  master->setHeight(100);
+  master->setType(dbMasterType::CORE);
+  master->setFrozen();
+
+  const dbShapeIndex* index = block_->getShapeIndex();
+  dbRegion* region = dbRegion::create(block_.get(), "region");
+  dbInst* inst = dbInst::create(block_.get(), master, "inst", region);
+
+  std::vector<dbShapeIndex::RectValue<dbInst*>> insts;
+  index->findInsts(Rect(50, 50, 60, 60), insts);
+  ASSERT_EQ(insts.size(), 1);
+  EXPECT_EQ(insts[0].second, inst);
+
+  inst->setLocation(200, 200);
+  insts.clear();
+  index->findInsts(Rect(50, 50, 60, 60), insts);
+  EXPECT_TRUE(insts.empty());
+  index->findInsts(Rect(250, 250, 260, 260), insts);
+  ASSERT_EQ(insts.size(), 1);
+  EXPECT_EQ(insts[0].second, inst);
+
+  dbInst::destroy(inst);
+  insts.clear();
+  index->findInsts(Rect(250, 250, 260, 260), insts);
+  EXPECT_TRUE(insts.empty());
+
+  block_->releaseShapeIndex();
+}
+
+TEST_F(OdbMultiPatternedTest, ShapeIndexRebuildsAfterRelease)
+{
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbWire* wire = dbWire::create(net);
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(300, 50);
+  encoder.end();
+
+  std::vector<dbShapeIndex::RectValue<dbNet*>> shapes;
+  block_->getShapeIndex()->findWires(met1, Rect(100, 40, 110, 60), shapes);
+  ASSERT_EQ(shapes.size(), 1);
+  block_->releaseShapeIndex();
+
+  // Edits after the release no longer reach the freed index.
+  dbNet::destroy(net);
+
+  shapes.clear();
+  block_->getShapeIndex()->findWires(met1, Rect(100, 40, 110, 60), shapes);
+  EXPECT_TRUE(shapes.empty());
+  block_->releaseShapeIndex();
+}
+
 }  // namespace odb
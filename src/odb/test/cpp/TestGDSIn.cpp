@@ -2,6 +2,8 @@
 #include <libgen.h>
 
 #include <boost/test/included/unit_test.hpp>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -202,6 +204,136 @@ BOOST_AUTO_TEST_CASE(edit)
   BOOST_TEST(ref_str == str1_read);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_writer)
+{
+  dbDatabase* db = dbDatabase::create();
+  dbGDSLib* lib = createEmptyGDSLib(db, "parallel_lib");
+
+  const int num_structs = 20;
+  for (int i = 0; i < num_structs; i++) {
+    dbGDSStructure* str
+        = dbGDSStructure::create(lib, ("str" + std::to_string(i)).c_str());
+    for (int j = 0; j <= i; j++) {
+      dbGDSBox* box = dbGDSBox::create(str);
+      box->setLayer(i);
+      box->setDatatype(j);
+      box->setBounds({0, 0, 100 * (j + 1), 100 * (i + 1)});
+    }
+  }
+
+  std::string outpath = testTmpPath("results", "parallel_test_out.gds");
+
+  auto logger = std::make_unique<utl::Logger>();
+  GDSWriter writer(logger.get());
+  writer.write_gds(lib, outpath, 4);
+
+  GDSReader reader(logger.get());
+  dbGDSLib* lib2 = reader.read_gds(outpath, db);
+
+  BOOST_TEST(lib2->getGDSStructures().size() == num_structs);
+  for (int i = 0; i < num_structs; i++) {
+    dbGDSStructure* str
+        = lib2->findGDSStructure(("str" + std::to_string(i)).c_str());
+    BOOST_TEST(str != nullptr);
+    BOOST_TEST(str->getGDSBoxs().size() == i + 1);
+    dbGDSBox* box = *str->getGDSBoxs().begin();
+    BOOST_TEST(box->getLayer() == i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(reader_top_cell)
+{
+  dbDatabase* db = dbDatabase::create();
+  dbGDSLib* lib = createEmptyGDSLib(db, "top_cell_lib");
+
+  dbGDSStructure* leaf = dbGDSStructure::create(lib, "leaf");
+  dbGDSStructure* unused = dbGDSStructure::create(lib, "unused");
+  dbGDSStructure* mid = dbGDSStructure::create(lib, "mid");
+  dbGDSStructure* top = dbGDSStructure::create(lib, "top");
+
+  dbGDSBox* box = dbGDSBox::create(leaf);
+  box->setLayer(1);
+  box->setBounds({0, 0, 10, 10});
+  dbGDSBox::create(unused)->setBounds({0, 0, 20, 20});
+  dbGDSSRef::create(mid, leaf);
+  dbGDSSRef::create(top, mid);
+  dbGDSSRef::create(unused, leaf);
+
+  std::string outpath = testTmpPath("results", "top_cell_test_out.gds");
+
+  auto logger = std::make_unique<utl::Logger>();
+  GDSWriter writer(logger.get());
+  writer.write_gds(lib, outpath);
+
+  GDSReader reader(logger.get());
+  dbGDSLib* lib2 = reader.read_gds(outpath, db, "top");
+
+  BOOST_TEST(lib2->getGDSStructures().size() == 3);
+  BOOST_TEST(lib2->findGDSStructure("unused") == nullptr);
+
+  dbGDSStructure* leaf_read = lib2->findGDSStructure("leaf");
+  BOOST_TEST(leaf_read != nullptr);
+  BOOST_TEST(leaf_read->getGDSBoxs().size() == 1);
+  BOOST_TEST((*leaf_read->getGDSBoxs().begin())->getLayer() == 1);
+
+  dbGDSStructure* top_read = lib2->findGDSStructure("top");
+  BOOST_TEST(top_read != nullptr);
+  BOOST_TEST(top_read->getGDSSRefs().size() == 1);
+  BOOST_TEST((*top_read->getGDSSRefs().begin())->getStructure()->getName()
+             == "mid");
+}
+
+BOOST_AUTO_TEST_CASE(reader_top_cell_odd_name)
+{
+  // GDS pads odd length names with a NUL to keep records an even length.
+  std::string gds;
+  auto append = [&gds](RecordType type, DataType data_type, std::string data) {
+    if (data.size() % 2 != 0) {
+      data.push_back('\0');
+    }
+    const uint16_t length = data.size() + 4;
+    gds.push_back(static_cast<char>(length >> 8));
+    gds.push_back(static_cast<char>(length & 0xff));
+    gds.push_back(static_cast<char>(type));
+    gds.push_back(static_cast<char>(data_type));
+    gds += data;
+  };
+  const std::string dates(24, '\0');
+  append(RecordType::HEADER, DataType::INT_2, std::string("\x02\x58", 2));
+  append(RecordType::BGNLIB, DataType::INT_2, dates);
+  append(RecordType::LIBNAME, DataType::ASCII_STRING, "odd");
+  append(RecordType::UNITS, DataType::REAL_8, std::string(16, '\0'));
+  for (const std::string name : {"cel", "other", "chip1"}) {
+    append(RecordType::BGNSTR, DataType::INT_2, dates);
+    append(RecordType::STRNAME, DataType::ASCII_STRING, name);
+    if (name == "chip1") {
+      append(RecordType::SREF, DataType::NO_DATA, "");
+      append(RecordType::SNAME, DataType::ASCII_STRING, "cel");
+      append(RecordType::XY, DataType::INT_4, std::string(8, '\0'));
+      append(RecordType::ENDEL, DataType::NO_DATA, "");
+    }
+    append(RecordType::ENDSTR, DataType::NO_DATA, "");
+  }
+  append(RecordType::ENDLIB, DataType::NO_DATA, "");
+
+  std::string path = testTmpPath("results", "odd_name_test.gds");
+  std::ofstream(path, std::ios::binary) << gds;
+
+  auto logger = std::make_unique<utl::Logger>();
+  dbDatabase* db = dbDatabase::create();
+  GDSReader reader(logger.get());
+  dbGDSLib* lib = reader.read_gds(path, db, "chip1");
+
+  BOOST_TEST(lib->getGDSStructures().size() == 2);
+  BOOST_TEST(lib->findGDSStructure("other") == nullptr);
+  BOOST_TEST(lib->findGDSStructure("cel") != nullptr);
+  dbGDSStructure* top = lib->findGDSStructure("chip1");
+  BOOST_TEST(top != nullptr);
+  BOOST_TEST(top->getGDSSRefs().size() == 1);
+  BOOST_TEST((*top->getGDSSRefs().begin())->getStructure()->getName()
+             == "cel");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
@@ -2,11 +2,13 @@
 #include <boost/test/included/unit_test.hpp>
 #include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "env.h"
 #include "helper.h"
 #include "odb/db.h"
+#include "utl/Logger.h"
 
 namespace odb {
 namespace {
@@ -36,6 +38,8 @@ struct F_DEFAULT
   dbBlock* block;
   dbMaster* and2;
   dbMaster* or2;
+  // For the databases read back, as replaying a checkpoint logs
+  utl::Logger logger;
 };
 
 BOOST_FIXTURE_TEST_CASE(test_undo_inst_create, F_DEFAULT)
@@ -236,6 +240,85 @@ BOOST_FIXTURE_TEST_CASE(test_undo_iterm_disconnect, F_DEFAULT)
   BOOST_TEST(iterm->getNet() == net);
 }
 
+BOOST_FIXTURE_TEST_CASE(test_checkpoint_replay, F_DEFAULT)
+{
+  std::stringstream base;
+  db->write(base);
+  dbDatabase::beginCheckpoint(block);
+
+  auto inst = dbInst::create(block, and2, "a");
+  inst->setPlacementStatus(dbPlacementStatus::PLACED);
+  inst->setLocation(1000, 2000);
+  // Kept eco changes are part of the checkpoint, undone ones are not
+  dbDatabase::beginEco(block);
+  inst->swapMaster(or2);
+  dbDatabase::endEco(block);
+  in_eco([&]() { dbNet::create(block, "n"); });
+  dbNet::create(block, "m");
+
+  BOOST_TEST(dbDatabase::hasCheckpoint(block));
+  std::stringstream checkpoint;
+  dbDatabase::writeCheckpoint(block, checkpoint);
+
+  dbDatabase* db2 = dbDatabase::create();
+  db2->setLogger(&logger);
+  db2->read(base);
+  auto block2 = db2->getChip()->getBlock();
+  BOOST_TEST(block2->findInst("a") == nullptr);
+  dbDatabase::readCheckpoint(block2, checkpoint);
+
+  auto inst2 = block2->findInst("a");
+  BOOST_TEST(inst2 != nullptr);
+  BOOST_TEST(inst2->getMaster()->getName() == "or2");
+  BOOST_TEST(inst2->getLocation() == Point(1000, 2000));
+  BOOST_TEST(block2->findNet("n") == nullptr);
+  BOOST_TEST(block2->findNet("m") != nullptr);
+  dbDatabase::destroy(db2);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_checkpoint_twice, F_DEFAULT)
+{
+  dbDatabase::beginCheckpoint(block);
+  dbInst::create(block, and2, "a");
+
+  // A second checkpoint restarts the recording from the new base
+  std::stringstream base;
+  db->write(base);
+  dbDatabase::beginCheckpoint(block);
+  dbNet::create(block, "n");
+
+  BOOST_TEST(dbDatabase::hasCheckpoint(block));
+  std::stringstream checkpoint;
+  dbDatabase::writeCheckpoint(block, checkpoint);
+
+  dbDatabase* db2 = dbDatabase::create();
+  db2->setLogger(&logger);
+  db2->read(base);
+  auto block2 = db2->getChip()->getBlock();
+  BOOST_TEST(block2->findInst("a") != nullptr);
+  dbDatabase::readCheckpoint(block2, checkpoint);
+  BOOST_TEST(block2->findNet("n") != nullptr);
+  dbDatabase::destroy(db2);
+
+  // Ecos still run on top of the new checkpoint
+  in_eco([&]() { dbNet::create(block, "m"); });
+  BOOST_TEST(block->findNet("m") == nullptr);
+  dbDatabase::endCheckpoint(block);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_checkpoint_invalid_undo, F_DEFAULT)
+{
+  dbDatabase::beginCheckpoint(block);
+  dbDatabase::beginEco(block);
+  dbInst::create(block, and2, "a");
+  dbDatabase::endEco(block);
+  // An edit recorded after the eco prevents dropping it on undo
+  dbNet::create(block, "n");
+  dbDatabase::undoEco(block);
+  BOOST_TEST(!dbDatabase::hasCheckpoint(block));
+  dbDatabase::endCheckpoint(block);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
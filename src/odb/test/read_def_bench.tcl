@@ -0,0 +1,71 @@
+# Benchmark of read_def on a synthetic DEF with a chain of NUM_INSTS
+# inverters, to measure the pre-sizing of the instance and net tables from
+# the COMPONENTS, NETS and SPECIALNETS counts.  With RESERVE=0 the sections
+# declare a count of 0, which read_def does not reserve for, e.g.
+#
+#   NUM_INSTS=2000000 openroad -exit read_def_bench.tcl
+#   NUM_INSTS=2000000 RESERVE=0 openroad -exit read_def_bench.tcl
+#
+# Only the time spent in read_def is reported, not the writing of the DEF.
+# The regression runs it on a small design and checks what was read.
+source "helpers.tcl"
+
+if { [info exists ::env(NUM_INSTS)] } {
+  set num_insts $::env(NUM_INSTS)
+} else {
+  set num_insts 10000
+}
+if { [info exists ::env(RESERVE)] } {
+  set reserve $::env(RESERVE)
+} else {
+  set reserve 1
+}
+
+proc section_count { count } {
+  variable reserve
+  if { $reserve } {
+    return $count
+  }
+  return 0
+}
+
+read_lef "data/Nangate45/NangateOpenCellLibrary.mod.lef"
+
+set def_file [make_result_file "read_def_bench_${num_insts}_${reserve}.def"]
+set stream [open $def_file w]
+puts $stream "VERSION 5.8 ;"
+puts $stream "DIVIDERCHAR \"/\" ;"
+puts $stream "BUSBITCHARS \"\[\]\" ;"
+puts $stream "DESIGN read_def_bench ;"
+puts $stream "UNITS DISTANCE MICRONS 2000 ;"
+puts $stream "DIEAREA ( 0 0 ) ( 2000000 2000000 ) ;"
+puts $stream "COMPONENTS [section_count $num_insts] ;"
+for { set i 0 } { $i < $num_insts } { incr i } {
+  puts $stream "- u$i INV_X1 ;"
+}
+puts $stream "END COMPONENTS"
+puts $stream "SPECIALNETS [section_count 2] ;"
+puts $stream "- VDD + USE POWER ;"
+puts $stream "- VSS + USE GROUND ;"
+puts $stream "END SPECIALNETS"
+puts $stream "NETS [section_count [expr $num_insts - 1]] ;"
+for { set i 1 } { $i < $num_insts } { incr i } {
+  puts $stream "- n$i ( u[expr $i - 1] ZN ) ( u$i A ) ;"
+}
+puts $stream "END NETS"
+puts $stream "END DESIGN"
+close $stream
+
+set elapsed [lindex [time { read_def $def_file }] 0]
+puts [format "read_def of %d instances (reserve %d): %.1f ms" \
+        $num_insts $reserve [expr $elapsed / 1000.0]]
+
+set block [ord::get_db_block]
+check "instance count" { llength [$block getInsts] } $num_insts
+check "net count" { llength [$block getNets] } [expr $num_insts + 1]
+check "last instance found by name" \
+  { [$block findInst u[expr $num_insts - 1]] getName } u[expr $num_insts - 1]
+check "last net found by name" \
+  { [$block findNet n[expr $num_insts - 1]] getName } n[expr $num_insts - 1]
+
+exit_summary
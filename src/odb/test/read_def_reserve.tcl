@@ -0,0 +1,51 @@
+# read_def sizes the instance and net tables from the COMPONENTS, NETS and
+# SPECIALNETS counts; every object must still be found by name afterwards.
+# The 54 nets created for the PINS cover the 2 special nets, so only NETS
+# reserves, for the 441 - 56 nets still to come.
+source "helpers.tcl"
+
+read_lef "data/Nangate45/NangateOpenCellLibrary.mod.lef"
+
+set_debug_level ODB defin 1
+utl::redirectStringBegin
+read_def "data/gcd/gcd_nangate45_route.def"
+set log [utl::redirectStringEnd]
+set_debug_level ODB defin 0
+
+check "components reserved" \
+  { regexp {COMPONENTS: reserving 1877 objects} $log } 1
+check "nets reserved" { regexp {NETS: reserving 385 objects} $log } 1
+check "special nets not reserved twice" \
+  { regexp {SPECIALNETS: reserving} $log } 0
+
+set block [ord::get_db_block]
+
+proc count_lost_insts { block } {
+  set count 0
+  foreach inst [$block getInsts] {
+    set found [$block findInst [$inst getName]]
+    if { $found == "NULL" || [$found getId] != [$inst getId] } {
+      incr count
+    }
+  }
+  return $count
+}
+
+proc count_lost_nets { block } {
+  set count 0
+  foreach net [$block getNets] {
+    set found [$block findNet [$net getName]]
+    if { $found == "NULL" || [$found getId] != [$net getId] } {
+      incr count
+    }
+  }
+  return $count
+}
+
+check "instance count" { llength [$block getInsts] } 1877
+check "net count" { llength [$block getNets] } 441
+check "every instance found by name" { count_lost_insts $block } 0
+check "every net found by name" { count_lost_nets $block } 0
+check "unknown instance not found" { $block findInst no_such_inst } NULL
+
+exit_summary
@@ -0,0 +1,19 @@
+# write_def formats the nets on several threads; the output must not
+# depend on the thread count
+source "helpers.tcl"
+
+read_lef "data/Nangate45/NangateOpenCellLibrary.mod.lef"
+read_def "data/gcd/gcd_nangate45_route.def"
+
+set serial_def [make_result_file write_def_threads_1.def]
+set_thread_count 1
+write_def $serial_def
+
+set parallel_def [make_result_file write_def_threads_4.def]
+set_thread_count 4
+write_def $parallel_def
+
+check "same DEF with 1 and 4 threads" \
+  { diff_files $serial_def $parallel_def } 0
+
+exit_summary
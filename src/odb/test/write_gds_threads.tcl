@@ -0,0 +1,27 @@
+# odb::write_gds encodes the structures on several threads; the output must
+# read back with the structures of the input
+source "helpers.tcl"
+
+proc gds_summary { lib } {
+  set summary {}
+  foreach str [$lib getGDSStructures] {
+    lappend summary [list [$str getName] \
+                       [llength [$str getGDSBoundarys]] \
+                       [llength [$str getGDSPaths]] \
+                       [llength [$str getGDSSRefs]] \
+                       [llength [$str getGDSTexts]]]
+  }
+  return [lsort $summary]
+}
+
+set db [ord::get_db]
+set lib [odb::read_gds $db "data/sky130_fd_sc_hd__inv_1.gds"]
+
+set out_gds [make_result_file write_gds_threads.gds]
+odb::write_gds $lib $out_gds 4
+set lib2 [odb::read_gds $db $out_gds]
+
+check "same structures after writing on 4 threads" \
+  { expr { [gds_summary $lib2] == [gds_summary $lib] } } 1
+
+exit_summary
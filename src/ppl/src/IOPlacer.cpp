@@ -24,6 +24,7 @@
 #include "SimulatedAnnealing.h"
 #include "Slots.h"
 #include "odb/db.h"
+#include "odb/dbShapeIndex.h"
 #include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
@@ -2905,48 +2906,20 @@ void IOPlacer::findSlotsForTopLayer()
 
 void IOPlacer::filterObstructedSlotsForTopLayer()
 {
-  // Collect top_grid obstructions
-  std::vector<odb::Rect> obstructions;
-
-  // Get routing obstructions
-  for (odb::dbObstruction* obstruction : getBlock()->getObstructions()) {
-    odb::dbBox* box = obstruction->getBBox();
-    if (top_grid_ != nullptr && top_grid_->layer != nullptr
-        && box->getTechLayer()->getRoutingLevel()
-               == top_grid_->layer->getRoutingLevel()) {
-      odb::Rect obstruction_rect = box->getBox();
-      obstructions.push_back(obstruction_rect);
-    }
-  }
-
-  // Get already routed special nets
-  for (odb::dbNet* net : getBlock()->getNets()) {
-    if (net->isSpecial()) {
-      for (odb::dbSWire* swire : net->getSWires()) {
-        for (odb::dbSBox* wire : swire->getWires()) {
-          if (!wire->isVia()) {
-            if (top_grid_ != nullptr && top_grid_->layer != nullptr
-                && wire->getTechLayer()->getRoutingLevel()
-                       == top_grid_->layer->getRoutingLevel()) {
-              odb::Rect obstruction_rect = wire->getBox();
-              obstructions.push_back(obstruction_rect);
-            }
-          }
-        }
-      }
-    }
-  }
+  odb::dbTechLayer* top_layer
+      = top_grid_ != nullptr ? top_grid_->layer : nullptr;
 
   // Get already placed pins
+  std::vector<odb::Rect> placed_pins;
   for (odb::dbBTerm* term : getBlock()->getBTerms()) {
     for (odb::dbBPin* pin : term->getBPins()) {
       if (pin->getPlacementStatus().isFixed()) {
         for (odb::dbBox* box : pin->getBoxes()) {
-          if (top_grid_ != nullptr && top_grid_->layer != nullptr
+          if (top_layer != nullptr
               && box->getTechLayer()->getRoutingLevel()
-                     == top_grid_->layer->getRoutingLevel()) {
+                     == top_layer->getRoutingLevel()) {
             odb::Rect obstruction_rect = box->getBox();
-            obstructions.push_back(obstruction_rect);
+            placed_pins.push_back(obstruction_rect);
           }
         }
       }
@@ -2966,16 +2939,35 @@ void IOPlacer::filterObstructedSlotsForTopLayer()
     }
   }
 
-  // check for slots that overlap with obstructions
-  for (odb::Rect& rect : obstructions) {
-    for (auto& slot : top_layer_slots_) {
-      odb::Point& point = slot.pos;
-      // mock slot with keepout
-      odb::Rect pin_rect(
-          point.x() - top_grid_->pin_width / 2 - top_grid_->keepout,
-          point.y() - top_grid_->pin_height / 2 - top_grid_->keepout,
-          point.x() + top_grid_->pin_width / 2 + top_grid_->keepout,
-          point.y() + top_grid_->pin_height / 2 + top_grid_->keepout);
+  // check for slots that overlap with routing obstructions, special net
+  // wires or placed pins. The obstructions and wires come from the block
+  // shape index instead of a scan of every shape for every slot.
+  const odb::dbShapeIndex* index = getBlock()->getShapeIndex();
+  std::vector<odb::dbShapeIndex::RectValue<odb::dbObstruction*>> obstructions;
+  std::vector<odb::dbShapeIndex::RectValue<odb::dbSBox*>> special_wires;
+  for (auto& slot : top_layer_slots_) {
+    odb::Point& point = slot.pos;
+    // mock slot with keepout
+    odb::Rect pin_rect(
+        point.x() - top_grid_->pin_width / 2 - top_grid_->keepout,
+        point.y() - top_grid_->pin_height / 2 - top_grid_->keepout,
+        point.x() + top_grid_->pin_width / 2 + top_grid_->keepout,
+        point.y() + top_grid_->pin_height / 2 + top_grid_->keepout);
+    if (top_layer != nullptr) {
+      obstructions.clear();
+      index->findObstructions(top_layer, pin_rect, obstructions);
+      special_wires.clear();
+      index->findSpecialWires(top_layer, pin_rect, special_wires);
+      const bool wire_blocks = std::any_of(
+          special_wires.begin(), special_wires.end(), [](const auto& shape) {
+            odb::dbSBox* wire = shape.second;
+            return !wire->isVia() && wire->getSWire()->getNet()->isSpecial();
+          });
+      if (!obstructions.empty() || wire_blocks) {
+        slot.blocked = true;
+      }
+    }
+    for (const odb::Rect& rect : placed_pins) {
       if (rect.intersects(pin_rect)) {  // mark slot as blocked
         slot.blocked = true;
       }
@@ -400,6 +400,9 @@ class Resizer : public dbStaState, public dbNetworkObserver
   // resizeSlackPreamble must be called before the first findResizeSlacks.
   void resizeSlackPreamble();
   void findResizeSlacks(bool run_journal_restore);
+  // Incremental pass: keep the current parasitics and timing, re-estimate
+  // only moved_nets and refresh the slacks. The netlist is not repaired.
+  void updateResizeSlacks(const std::vector<dbNet*>& moved_nets);
   // Return nets with worst slack.
   NetSeq resizeWorstSlackNets();
   // Return net slack, if any (indicated by the bool).
@@ -2046,6 +2046,17 @@ void Resizer::findResizeSlacks(bool run_journal_restore)
   }
 }
 
+void Resizer::updateResizeSlacks(const std::vector<dbNet*>& moved_nets)
+{
+  IncrementalParasiticsGuard guard(this);
+  for (const dbNet* net : moved_nets) {
+    parasiticsInvalid(net);
+  }
+  guard.update();
+  ensureLevelDrvrVertices();
+  findResizeSlacks1();
+}
+
 void Resizer::findResizeSlacks1()
 {
   // Use driver pin slacks rather than Sta::netSlack to save visiting